@@ -0,0 +1,123 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <ForceDemandFrame.h>
+#include <CRC.h>
+
+#include <climits>
+
+using namespace LSST::M1M3::SS;
+
+// byte offsets in ILCMessageFactory::broadcastForceDemand frame
+const static int32_t BROADCAST_COUNTER_OFFSET = 2;
+const static int32_t SLEW_FLAG_OFFSET = 3;
+const static int32_t SAA_OFFSET = 4;
+const static int32_t DAA_OFFSET = SAA_OFFSET + 16 * 3;
+const static int32_t CRC_OFFSET = DAA_OFFSET + 32 * 6;
+
+static const ModbusCRCPatcher forceDemandCRC(CRC_OFFSET);
+
+// setpoints are 24 bit, so this value is never written to the frame
+const static int32_t UNKNOWN_VALUE = INT32_MIN;
+
+ForceDemandFrame::ForceDemandFrame() : _frameIndex(-1), _changed(0) {
+    _primaryIndices.reserve(48);
+    _secondaryIndices.reserve(32);
+    _offsets.reserve(80);
+    _values.reserve(80);
+    _written.reserve(80);
+}
+
+void ForceDemandFrame::reset(int32_t frameIndex) {
+    _frameIndex = frameIndex;
+    _primaryIndices.clear();
+    _secondaryIndices.clear();
+    _offsets.clear();
+    _values.clear();
+    _written.clear();
+}
+
+void ForceDemandFrame::addActuator(uint8_t address, int32_t primaryDataIndex, int32_t secondaryDataIndex) {
+    int32_t offset = address <= 16 ? SAA_OFFSET + (address - 1) * 3 : DAA_OFFSET + (address - 17) * 6;
+    _offsets.insert(_offsets.begin() + _primaryIndices.size(), offset);
+    _primaryIndices.push_back(primaryDataIndex);
+    if (address > 16) {
+        _offsets.push_back(offset + 3);
+        _secondaryIndices.push_back(secondaryDataIndex);
+    }
+    _values.resize(_offsets.size());
+    _written.assign(_offsets.size(), UNKNOWN_VALUE);
+}
+
+void ForceDemandFrame::update(ModbusBuffer* buffer, uint8_t broadcastCounter, bool slewFlag,
+                              const int32_t* primarySetpoints, const int32_t* secondarySetpoints) {
+    uint16_t* frame = buffer->getBuffer() + _frameIndex;
+    uint16_t crc = ModbusBuffer::readInstructionByte(frame[CRC_OFFSET]) |
+                   (ModbusBuffer::readInstructionByte(frame[CRC_OFFSET + 1]) << 8);
+
+    _changed = 0;
+    _write(frame, crc, BROADCAST_COUNTER_OFFSET, broadcastCounter);
+    _write(frame, crc, SLEW_FLAG_OFFSET, slewFlag ? 255 : 0);
+
+    size_t primaryCount = _primaryIndices.size();
+    size_t secondaryCount = _secondaryIndices.size();
+    int32_t* values = _values.data();
+    const int32_t* primaryIndices = _primaryIndices.data();
+    const int32_t* secondaryIndices = _secondaryIndices.data();
+    for (size_t i = 0; i < primaryCount; i++) {
+        values[i] = primarySetpoints[primaryIndices[i]];
+    }
+    for (size_t i = 0; i < secondaryCount; i++) {
+        values[primaryCount + i] = secondarySetpoints[secondaryIndices[i]];
+    }
+
+    size_t count = primaryCount + secondaryCount;
+    for (size_t i = 0; i < count; i++) {
+        int32_t value = values[i];
+        if (value == _written[i]) {
+            continue;
+        }
+        _written[i] = value;
+        int32_t offset = _offsets[i];
+        _write(frame, crc, offset, value >> 16);
+        _write(frame, crc, offset + 1, value >> 8);
+        _write(frame, crc, offset + 2, value);
+    }
+
+    if (_changed == 0) {
+        return;
+    }
+
+    frame[CRC_OFFSET] = ModbusBuffer::writeByteInstruction(crc);
+    frame[CRC_OFFSET + 1] = ModbusBuffer::writeByteInstruction(crc >> 8);
+}
+
+void ForceDemandFrame::_write(uint16_t* frame, uint16_t& crc, int32_t offset, uint8_t data) {
+    uint8_t old = ModbusBuffer::readInstructionByte(frame[offset]);
+    if (old == data) {
+        return;
+    }
+    _changed++;
+    crc = forceDemandCRC.patch(crc, offset, old, data);
+    frame[offset] = ModbusBuffer::writeByteInstruction(data);
+}
@@ -0,0 +1,99 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef FORCEDEMANDFRAME_H_
+#define FORCEDEMANDFRAME_H_
+
+#include <DataTypes.h>
+#include <ModbusBuffer.h>
+#include <vector>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Patchable template of broadcast force demand (function code 75) frame,
+ * written into bus list buffer by ILCMessageFactory::broadcastForceDemand.
+ * Byte offsets of actuators setpoints are recorded when the bus list is
+ * built. Update then rewrites only changed bytes and updates frame CRC
+ * incrementally, without recalculating it over the whole frame.
+ *
+ * Setpoints are gathered from cylinder force arrays through precomputed
+ * index tables - primary setpoints first, secondary setpoints follow. Bus
+ * list can thus write zero setpoints template and fill it with update call.
+ */
+class ForceDemandFrame {
+public:
+    ForceDemandFrame();
+
+    /**
+     * Starts new frame. Clears actuators.
+     *
+     * @param frameIndex buffer index of the frame first (address) word
+     */
+    void reset(int32_t frameIndex);
+
+    /**
+     * Adds actuator to the frame.
+     *
+     * @param address ILC address. 1-16 for single axis, 17-48 for dual axis actuators
+     * @param primaryDataIndex index of the primary cylinder setpoint
+     * @param secondaryDataIndex index of the secondary cylinder setpoint, ignored for single axis actuators
+     */
+    void addActuator(uint8_t address, int32_t primaryDataIndex, int32_t secondaryDataIndex);
+
+    /**
+     * Updates frame in buffer with new values.
+     *
+     * @param buffer bus list buffer. Frame shall be already written at frameIndex
+     * @param broadcastCounter broadcast counter
+     * @param slewFlag slew flag
+     * @param primarySetpoints primary cylinder setpoints (mN), indexed by primary data index
+     * @param secondarySetpoints secondary cylinder setpoints (mN), indexed by secondary data index
+     */
+    void update(ModbusBuffer* buffer, uint8_t broadcastCounter, bool slewFlag,
+                const int32_t* primarySetpoints, const int32_t* secondarySetpoints);
+
+private:
+    void _write(uint16_t* frame, uint16_t& crc, int32_t offset, uint8_t data);
+
+    int32_t _frameIndex;
+
+    // gather tables - indices into primary and secondary setpoint arrays
+    std::vector<int32_t> _primaryIndices;
+    std::vector<int32_t> _secondaryIndices;
+    // frame byte offsets of gathered values, primary then secondary setpoints
+    std::vector<int32_t> _offsets;
+    // gathered and last written values, in _offsets order
+    std::vector<int32_t> _values;
+    std::vector<int32_t> _written;
+
+    int _changed;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* FORCEDEMANDFRAME_H_ */
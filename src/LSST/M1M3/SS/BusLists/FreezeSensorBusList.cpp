@@ -62,12 +62,9 @@ void FreezeSensorBusList::buildBuffer() {
                     this->expectedFAResponses[dataIndex] = 1;
                 }
             }
-            int32_t statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            while (this->subnetData->getFAIndex(subnetIndex, statusIndex).Disabled) {
-                _roundRobinFAReportServerStatusIndex[subnetIndex] =
-                        RoundRobin::Inc(statusIndex, this->subnetData->getFACount(subnetIndex));
-                statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            }
+            int32_t statusIndex =
+                    _nextEnabledFA(subnetIndex, _roundRobinFAReportServerStatusIndex[subnetIndex]);
+            _roundRobinFAReportServerStatusIndex[subnetIndex] = statusIndex;
             uint8_t address = this->subnetData->getFAIndex(subnetIndex, statusIndex).Address;
             int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, statusIndex).DataIndex;
             _faStatusCommandIndex[subnetIndex] = this->buffer.getIndex();
@@ -133,14 +130,9 @@ void FreezeSensorBusList::update() {
             int32_t statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
             int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, statusIndex).DataIndex;
             this->expectedFAResponses[dataIndex] = 1;
-            _roundRobinFAReportServerStatusIndex[subnetIndex] =
-                    RoundRobin::Inc(statusIndex, this->subnetData->getFACount(subnetIndex));
-            statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            while (this->subnetData->getFAIndex(subnetIndex, statusIndex).Disabled) {
-                _roundRobinFAReportServerStatusIndex[subnetIndex] =
-                        RoundRobin::Inc(statusIndex, this->subnetData->getFACount(subnetIndex));
-                statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            }
+            statusIndex = _nextEnabledFA(
+                    subnetIndex, RoundRobin::Inc(statusIndex, this->subnetData->getFACount(subnetIndex)));
+            _roundRobinFAReportServerStatusIndex[subnetIndex] = statusIndex;
             uint8_t address = this->subnetData->getFAIndex(subnetIndex, statusIndex).Address;
             dataIndex = this->subnetData->getFAIndex(subnetIndex, statusIndex).DataIndex;
 
@@ -171,3 +163,9 @@ void FreezeSensorBusList::update() {
         }
     }
 }
+
+int32_t FreezeSensorBusList::_nextEnabledFA(int32_t subnetIndex, int32_t faIndex) {
+    int32_t enabled = this->subnetData->findEnabledFA(subnetIndex, faIndex);
+    // keep querying the current FA if all FAs on subnet are disabled
+    return enabled < 0 ? faIndex : enabled;
+}
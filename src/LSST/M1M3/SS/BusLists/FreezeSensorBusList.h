@@ -46,6 +46,8 @@ private:
     int32_t _roundRobinFAReportServerStatusIndex[5];
     int32_t _hmLVDTCommandIndex[5];
     int32_t _lvdtSampleClock;
+
+    int32_t _nextEnabledFA(int32_t subnetIndex, int32_t faIndex);
 };
 
 } /* namespace SS */
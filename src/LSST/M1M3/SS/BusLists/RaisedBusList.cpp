@@ -24,11 +24,11 @@
 #include <RaisedBusList.h>
 #include <ILCSubnetData.h>
 #include <ILCMessageFactory.h>
+#include <ILCApplicationSettings.h>
 #include <M1M3SSPublisher.h>
 #include <RoundRobin.h>
 #include <ForceConverter.h>
 #include <SAL_MTM1M3C.h>
-#include <cstring>
 #include <spdlog/spdlog.h>
 
 using namespace LSST::M1M3::SS;
@@ -47,62 +47,47 @@ void RaisedBusList::buildBuffer() {
     BusList::buildBuffer();
     SPDLOG_DEBUG("RaisedBusList: buildBuffer()");
 
-    _lvdtSampleClock = 0;
+    ILCApplicationSettings* timings = this->ilcMessageFactory->getILCApplicationSettings();
     for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
         _setForceCommandIndex[subnetIndex] = -1;
         _moveStepCommandIndex[subnetIndex] = -1;
-        _faStatusCommandIndex[subnetIndex] = -1;
-        _roundRobinFAReportServerStatusIndex[subnetIndex] = 0;
     }
     for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
         this->startSubnet(subnetIndex);
+        _statusPolls[subnetIndex].reset(this->ilcMessageFactory);
+        uint32_t fixedCost = 0;
         if (this->subnetData->getFACount(subnetIndex) > 0) {
             _setForceCommandIndex[subnetIndex] = this->buffer.getIndex();
-            int32_t saaPrimary[16];
-            int32_t daaPrimary[32];
-            int32_t daaSecondary[32];
-            memset(saaPrimary, 0, sizeof(saaPrimary));
-            memset(daaPrimary, 0, sizeof(daaPrimary));
-            memset(daaSecondary, 0, sizeof(daaSecondary));
-            for (int faIndex = 0; faIndex < this->subnetData->getFACount(subnetIndex); faIndex++) {
-                uint8_t address = this->subnetData->getFAIndex(subnetIndex, faIndex).Address;
-                int32_t primaryDataIndex = this->subnetData->getFAIndex(subnetIndex, faIndex).DataIndex;
-                int32_t secondaryDataIndex =
-                        this->subnetData->getFAIndex(subnetIndex, faIndex).SecondaryDataIndex;
-
-                if (address <= 16) {
-                    saaPrimary[address - 1] = _appliedCylinderForces->primaryCylinderForces[primaryDataIndex];
-                } else {
-                    daaPrimary[address - 17] =
-                            _appliedCylinderForces->primaryCylinderForces[primaryDataIndex];
-                    daaSecondary[address - 17] =
-                            _appliedCylinderForces->secondaryCylinderForces[secondaryDataIndex];
-                }
+            _forceDemandFrames[subnetIndex].reset(_setForceCommandIndex[subnetIndex]);
+            const std::vector<uint8_t>& addresses = this->subnetData->getFAAddresses(subnetIndex);
+            const std::vector<int32_t>& primaryDataIndices = this->subnetData->getFADataIndices(subnetIndex);
+            const std::vector<int32_t>& secondaryDataIndices =
+                    this->subnetData->getFASecondaryDataIndices(subnetIndex);
+            uint64_t disabledMask = this->subnetData->getFADisabledMask(subnetIndex);
+            int32_t faCount = addresses.size();
+            for (int faIndex = 0; faIndex < faCount; faIndex++) {
+                _forceDemandFrames[subnetIndex].addActuator(addresses[faIndex], primaryDataIndices[faIndex],
+                                                            secondaryDataIndices[faIndex]);
             }
+            // zero setpoints template, filled from the gather tables
             this->ilcMessageFactory->broadcastForceDemand(&this->buffer, _outerLoopData->broadcastCounter,
-                                                          _outerLoopData->slewFlag, saaPrimary, daaPrimary,
-                                                          daaSecondary);
+                                                          _outerLoopData->slewFlag);
+            _forceDemandFrames[subnetIndex].update(&this->buffer, _outerLoopData->broadcastCounter,
+                                                   _outerLoopData->slewFlag,
+                                                   _appliedCylinderForces->primaryCylinderForces,
+                                                   _appliedCylinderForces->secondaryCylinderForces);
             this->buffer.writeTimestamp();
-            for (int faIndex = 0; faIndex < this->subnetData->getFACount(subnetIndex); faIndex++) {
-                uint8_t address = this->subnetData->getFAIndex(subnetIndex, faIndex).Address;
-                int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, faIndex).DataIndex;
-                bool disabled = this->subnetData->getFAIndex(subnetIndex, faIndex).Disabled;
-                if (!disabled) {
+            fixedCost += timings->BroadcastForceDemand;
+            for (int faIndex = 0; faIndex < faCount; faIndex++) {
+                uint8_t address = addresses[faIndex];
+                int32_t dataIndex = primaryDataIndices[faIndex];
+                if ((disabledMask & ((uint64_t)1 << faIndex)) == 0) {
                     this->ilcMessageFactory->pneumaticForceStatus(&this->buffer, address);
                     this->expectedFAResponses[dataIndex] = 1;
+                    _statusPolls[subnetIndex].addFA(address, dataIndex);
+                    fixedCost += timings->PneumaticForceAndStatus;
                 }
             }
-            int32_t statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            while (this->subnetData->getFAIndex(subnetIndex, statusIndex).Disabled) {
-                _roundRobinFAReportServerStatusIndex[subnetIndex] =
-                        RoundRobin::Inc(statusIndex, this->subnetData->getFACount(subnetIndex));
-                statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            }
-            uint8_t address = this->subnetData->getFAIndex(subnetIndex, statusIndex).Address;
-            int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, statusIndex).DataIndex;
-            _faStatusCommandIndex[subnetIndex] = this->buffer.getIndex();
-            this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
-            this->expectedFAResponses[dataIndex] = 2;
         }
         if (this->subnetData->getHPCount(subnetIndex) > 0) {
             _moveStepCommandIndex[subnetIndex] = this->buffer.getIndex();
@@ -117,6 +102,7 @@ void RaisedBusList::buildBuffer() {
             this->ilcMessageFactory->broadcastStepMotor(&this->buffer, _outerLoopData->broadcastCounter,
                                                         steps);
             this->buffer.writeTimestamp();
+            fixedCost += timings->BroadcastStepMotor;
             for (int hpIndex = 0; hpIndex < this->subnetData->getHPCount(subnetIndex); hpIndex++) {
                 uint8_t address = this->subnetData->getHPIndex(subnetIndex, hpIndex).Address;
                 int32_t dataIndex = this->subnetData->getHPIndex(subnetIndex, hpIndex).DataIndex;
@@ -125,6 +111,7 @@ void RaisedBusList::buildBuffer() {
                     this->ilcMessageFactory->electromechanicalForceAndStatus(&this->buffer, address);
                     this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
                     this->expectedHPResponses[dataIndex] = 2;
+                    fixedCost += timings->ElectromechanicalForceAndStatus + timings->ReportServerStatus;
                 }
             }
         }
@@ -134,21 +121,12 @@ void RaisedBusList::buildBuffer() {
             bool disabled = this->subnetData->getHMIndex(subnetIndex, hmIndex).Disabled;
             if (!disabled) {
                 this->ilcMessageFactory->reportDCAPressure(&this->buffer, address);
-                this->ilcMessageFactory->reportDCAStatus(&this->buffer, address);
-                this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
-                this->expectedHMResponses[dataIndex] = 3;
-            }
-        }
-        if (this->subnetData->getHMCount(subnetIndex) > 0) {
-            _hmLVDTCommandIndex[subnetIndex] = this->buffer.getIndex();
-            for (int hmIndex = 0; hmIndex < this->subnetData->getHMCount(subnetIndex); hmIndex++) {
-                uint8_t address = this->subnetData->getHMIndex(subnetIndex, hmIndex).Address;
-                bool disabled = this->subnetData->getHMIndex(subnetIndex, hmIndex).Disabled;
-                if (!disabled) {
-                    this->ilcMessageFactory->nopReportLVDT(&this->buffer, address);
-                }
+                this->expectedHMResponses[dataIndex] = 1;
+                _statusPolls[subnetIndex].addHM(address, dataIndex);
+                fixedCost += timings->ReportDCAPressure;
             }
         }
+        _statusPolls[subnetIndex].buildSlots(&this->buffer, fixedCost);
         this->endSubnet();
     }
     this->buffer.setLength(this->buffer.getIndex());
@@ -159,49 +137,10 @@ void RaisedBusList::update() {
 
     for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
         if (this->subnetData->getFACount(subnetIndex) > 0) {
-            int32_t saaPrimary[16];
-            int32_t daaPrimary[32];
-            int32_t daaSecondary[32];
-            memset(saaPrimary, 0, sizeof(saaPrimary));
-            memset(daaPrimary, 0, sizeof(daaPrimary));
-            memset(daaSecondary, 0, sizeof(daaSecondary));
-            for (int faIndex = 0; faIndex < this->subnetData->getFACount(subnetIndex); faIndex++) {
-                uint8_t address = this->subnetData->getFAIndex(subnetIndex, faIndex).Address;
-                int32_t primaryDataIndex = this->subnetData->getFAIndex(subnetIndex, faIndex).DataIndex;
-                int32_t secondaryDataIndex =
-                        this->subnetData->getFAIndex(subnetIndex, faIndex).SecondaryDataIndex;
-
-                if (address <= 16) {
-                    saaPrimary[address - 1] = _appliedCylinderForces->primaryCylinderForces[primaryDataIndex];
-                } else {
-                    daaPrimary[address - 17] =
-                            _appliedCylinderForces->primaryCylinderForces[primaryDataIndex];
-                    daaSecondary[address - 17] =
-                            _appliedCylinderForces->secondaryCylinderForces[secondaryDataIndex];
-                }
-            }
-            this->buffer.setIndex(_setForceCommandIndex[subnetIndex]);
-            this->ilcMessageFactory->broadcastForceDemand(&this->buffer, _outerLoopData->broadcastCounter,
-                                                          _outerLoopData->slewFlag, saaPrimary, daaPrimary,
-                                                          daaSecondary);
-
-            int32_t statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, statusIndex).DataIndex;
-            this->expectedFAResponses[dataIndex] = 1;
-            _roundRobinFAReportServerStatusIndex[subnetIndex] =
-                    RoundRobin::Inc(statusIndex, this->subnetData->getFACount(subnetIndex));
-            statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            while (this->subnetData->getFAIndex(subnetIndex, statusIndex).Disabled) {
-                _roundRobinFAReportServerStatusIndex[subnetIndex] =
-                        RoundRobin::Inc(statusIndex, this->subnetData->getFACount(subnetIndex));
-                statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            }
-            uint8_t address = this->subnetData->getFAIndex(subnetIndex, statusIndex).Address;
-            dataIndex = this->subnetData->getFAIndex(subnetIndex, statusIndex).DataIndex;
-
-            this->buffer.setIndex(_faStatusCommandIndex[subnetIndex]);
-            this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
-            this->expectedFAResponses[dataIndex] = 2;
+            _forceDemandFrames[subnetIndex].update(&this->buffer, _outerLoopData->broadcastCounter,
+                                                   _outerLoopData->slewFlag,
+                                                   _appliedCylinderForces->primaryCylinderForces,
+                                                   _appliedCylinderForces->secondaryCylinderForces);
         }
         if (this->subnetData->getHPCount(subnetIndex) > 0) {
             int8_t steps[78];
@@ -216,26 +155,7 @@ void RaisedBusList::update() {
             this->ilcMessageFactory->broadcastStepMotor(&this->buffer, _outerLoopData->broadcastCounter,
                                                         steps);
         }
-        if (this->subnetData->getHMCount(subnetIndex) > 0) {
-            this->buffer.setIndex(_hmLVDTCommandIndex[subnetIndex]);
-            for (int hmIndex = 0; hmIndex < this->subnetData->getHMCount(subnetIndex); hmIndex++) {
-                uint8_t address = this->subnetData->getHMIndex(subnetIndex, hmIndex).Address;
-                int32_t dataIndex = this->subnetData->getHMIndex(subnetIndex, hmIndex).DataIndex;
-                bool disabled = this->subnetData->getHMIndex(subnetIndex, hmIndex).Disabled;
-                if (!disabled) {
-                    if (_lvdtSampleClock == 0) {
-                        this->ilcMessageFactory->reportLVDT(&this->buffer, address);
-                        this->expectedHMResponses[dataIndex] = 4;
-                    } else {
-                        this->ilcMessageFactory->nopReportLVDT(&this->buffer, address);
-                        this->expectedHMResponses[dataIndex] = 3;
-                    }
-                }
-            }
-            _lvdtSampleClock--;
-            if (_lvdtSampleClock < 0) {
-                _lvdtSampleClock = 4;
-            }
-        }
+        _statusPolls[subnetIndex].update(&this->buffer, this->expectedFAResponses,
+                                         this->expectedHMResponses);
     }
 }
@@ -25,6 +25,8 @@
 #define RAISEDBUSLIST_H_
 
 #include <BusList.h>
+#include <ForceDemandFrame.h>
+#include <StatusPollList.h>
 #include <SAL_MTM1M3C.h>
 
 namespace LSST {
@@ -46,11 +48,9 @@ private:
     MTM1M3_logevent_forceActuatorInfoC* _forceInfo;
 
     int32_t _setForceCommandIndex[5];
+    ForceDemandFrame _forceDemandFrames[5];
     int32_t _moveStepCommandIndex[5];
-    int32_t _faStatusCommandIndex[5];
-    int32_t _roundRobinFAReportServerStatusIndex[5];
-    int32_t _hmLVDTCommandIndex[5];
-    int32_t _lvdtSampleClock;
+    StatusPollList _statusPolls[5];
 };
 
 } /* namespace SS */
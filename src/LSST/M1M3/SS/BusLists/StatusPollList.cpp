@@ -0,0 +1,135 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <StatusPollList.h>
+#include <ILCApplicationSettings.h>
+#include <ILCMessageFactory.h>
+#include <M1M3SSPublisher.h>
+
+#include <algorithm>
+
+using namespace LSST::M1M3::SS;
+
+// LVDT was historically read every 5th cycle
+const static uint32_t LVDT_PERIOD = 5;
+
+StatusPollList::StatusPollList() : _ilcMessageFactory(nullptr), _slotIndex(-1), _slots(0), _budget(0) {}
+
+void StatusPollList::reset(ILCMessageFactory* ilcMessageFactory) {
+    _ilcMessageFactory = ilcMessageFactory;
+    _scheduler.clear();
+    _requests.clear();
+    _slotIndex = -1;
+    _slots = 0;
+    _budget = 0;
+}
+
+void StatusPollList::addFA(uint8_t address, int32_t dataIndex) {
+    ILCApplicationSettings* settings = _ilcMessageFactory->getILCApplicationSettings();
+    _add(FA_SERVER_STATUS, address, dataIndex, settings->ReportServerStatus, 1);
+}
+
+void StatusPollList::addHM(uint8_t address, int32_t dataIndex) {
+    ILCApplicationSettings* settings = _ilcMessageFactory->getILCApplicationSettings();
+    _add(HM_SERVER_STATUS, address, dataIndex, settings->ReportServerStatus, 1);
+    _add(HM_DCA_STATUS, address, dataIndex, settings->ReportDCAStatus, 1);
+    _add(HM_LVDT, address, dataIndex, settings->ReportLVDT, LVDT_PERIOD);
+}
+
+void StatusPollList::buildSlots(ModbusBuffer* buffer, uint32_t fixedCost) {
+    uint32_t slotTime = _ilcMessageFactory->getILCApplicationSettings()->StatusPollSlotTime;
+    _budget = slotTime > fixedCost ? slotTime - fixedCost : 0;
+    // all status requests and nop are of the same length, so slots can be rewritten in place
+    _slotIndex = buffer->getIndex();
+    _slots = 0;
+    uint32_t minimalCost = _scheduler.getMinimalCost();
+    if (minimalCost == 0) {
+        _slots = _requests.size();
+    } else if (_requests.empty() == false) {
+        _slots = std::min(_requests.size(), std::max<size_t>(1, _budget / minimalCost));
+    }
+    for (size_t i = 0; i < _slots; i++) {
+        _ilcMessageFactory->nopReportLVDT(buffer, 0);
+    }
+}
+
+void StatusPollList::update(ModbusBuffer* buffer, int32_t* expectedFAResponses,
+                            int32_t* expectedHMResponses) {
+    if (_slots == 0) {
+        return;
+    }
+
+    for (auto i : _scheduler.getScheduled()) {
+        if (_requests[i].type == FA_SERVER_STATUS) {
+            expectedFAResponses[_requests[i].dataIndex]--;
+        } else {
+            expectedHMResponses[_requests[i].dataIndex]--;
+        }
+    }
+
+    ForceActuatorWarning* faWarning = M1M3SSPublisher::getForceActuatorWarning();
+    MTM1M3_logevent_hardpointMonitorWarningC* hmWarning =
+            M1M3SSPublisher::get().getEventHardpointMonitorWarning();
+    for (size_t i = 0; i < _requests.size(); i++) {
+        int32_t dataIndex = _requests[i].dataIndex;
+        if (_requests[i].type == FA_SERVER_STATUS) {
+            _scheduler.setBoosted(i, faWarning->majorFault[dataIndex] || faWarning->minorFault[dataIndex] ||
+                                             faWarning->ilcFault[dataIndex]);
+        } else {
+            _scheduler.setBoosted(i, hmWarning->majorFault[dataIndex] || hmWarning->minorFault[dataIndex]);
+        }
+    }
+
+    auto& scheduled = _scheduler.schedule(_budget, _slots);
+
+    buffer->setIndex(_slotIndex);
+    for (auto i : scheduled) {
+        const Request& request = _requests[i];
+        switch (request.type) {
+            case FA_SERVER_STATUS:
+            case HM_SERVER_STATUS:
+                _ilcMessageFactory->reportServerStatus(buffer, request.address);
+                break;
+            case HM_DCA_STATUS:
+                _ilcMessageFactory->reportDCAStatus(buffer, request.address);
+                break;
+            case HM_LVDT:
+                _ilcMessageFactory->reportLVDT(buffer, request.address);
+                break;
+        }
+        if (request.type == FA_SERVER_STATUS) {
+            expectedFAResponses[request.dataIndex]++;
+        } else {
+            expectedHMResponses[request.dataIndex]++;
+        }
+    }
+    for (size_t i = scheduled.size(); i < _slots; i++) {
+        _ilcMessageFactory->nopReportLVDT(buffer, 0);
+    }
+}
+
+void StatusPollList::_add(RequestType type, uint8_t address, int32_t dataIndex, uint32_t cost,
+                          uint32_t period) {
+    _scheduler.addRequest(cost, period);
+    _requests.push_back(Request{type, address, dataIndex});
+}
@@ -0,0 +1,123 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef STATUSPOLLLIST_H_
+#define STATUSPOLLLIST_H_
+
+#include <DataTypes.h>
+#include <ModbusBuffer.h>
+#include <StatusPollScheduler.h>
+#include <vector>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+class ILCMessageFactory;
+
+/**
+ * Low priority status requests of a subnet - FA and HM server status, HM DCA
+ * status and HM LVDT. A fixed number of request slots is reserved in the bus
+ * list buffer when the buffer is built. On every update, StatusPollScheduler
+ * selects requests fitting into the subnet time remaining after the fixed
+ * (force demand, telemetry) traffic, and the selected requests are written
+ * into the slots. Unused slots are filled with nop.
+ *
+ * Subnet time is ILCApplicationSettings::StatusPollSlotTime. Request costs
+ * are ILCApplicationSettings timings of the messages.
+ */
+class StatusPollList {
+public:
+    StatusPollList();
+
+    /**
+     * Clears all requests.
+     *
+     * @param ilcMessageFactory factory writing requests, its
+     * ILCApplicationSettings provide request costs and slot time
+     */
+    void reset(ILCMessageFactory* ilcMessageFactory);
+
+    /**
+     * Adds force actuator server status request.
+     *
+     * @param address ILC address
+     * @param dataIndex FA index
+     */
+    void addFA(uint8_t address, int32_t dataIndex);
+
+    /**
+     * Adds hardpoint monitor server status, DCA status and LVDT requests.
+     *
+     * @param address ILC address
+     * @param dataIndex HM index
+     */
+    void addHM(uint8_t address, int32_t dataIndex);
+
+    /**
+     * Reserves request slots in buffer and fills them with nop. Shall be
+     * called after all requests were added, when the subnet fixed messages
+     * are already written.
+     *
+     * @param buffer bus list buffer
+     * @param fixedCost wire time of the subnet fixed messages (microseconds)
+     */
+    void buildSlots(ModbusBuffer* buffer, uint32_t fixedCost);
+
+    /**
+     * Schedules requests for the next cycle, writes them into the slots and
+     * updates expected responses.
+     *
+     * @param buffer bus list buffer
+     * @param expectedFAResponses FA expected responses of the bus list
+     * @param expectedHMResponses HM expected responses of the bus list
+     */
+    void update(ModbusBuffer* buffer, int32_t* expectedFAResponses, int32_t* expectedHMResponses);
+
+    size_t getSlots() { return _slots; }
+    uint32_t getBudget() { return _budget; }
+
+private:
+    enum RequestType { FA_SERVER_STATUS, HM_SERVER_STATUS, HM_DCA_STATUS, HM_LVDT };
+
+    struct Request {
+        RequestType type;
+        uint8_t address;
+        int32_t dataIndex;
+    };
+
+    void _add(RequestType type, uint8_t address, int32_t dataIndex, uint32_t cost, uint32_t period);
+
+    ILCMessageFactory* _ilcMessageFactory;
+    StatusPollScheduler _scheduler;
+    std::vector<Request> _requests;
+    int32_t _slotIndex;
+    size_t _slots;
+    uint32_t _budget;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* STATUSPOLLLIST_H_ */
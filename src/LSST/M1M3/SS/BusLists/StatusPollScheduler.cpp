@@ -0,0 +1,114 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <StatusPollScheduler.h>
+
+#include <algorithm>
+
+using namespace LSST::M1M3::SS;
+
+// period of all requests is multiplied by this to compare priorities in integers
+const static uint64_t PRIORITY_SCALE = 720720;
+
+StatusPollScheduler::StatusPollScheduler(uint32_t boostFactor, uint32_t boostHold)
+        : _boostFactor(boostFactor), _boostHold(boostHold) {}
+
+void StatusPollScheduler::clear() {
+    _requests.clear();
+    _order.clear();
+    _scheduled.clear();
+}
+
+size_t StatusPollScheduler::addRequest(uint32_t cost, uint32_t period) {
+    if (period == 0) {
+        period = 1;
+    }
+    // new requests are due immediately
+    _requests.push_back(Request{cost, period, period, 0});
+    _order.push_back(_order.size());
+    _scheduled.reserve(_requests.size());
+    return _requests.size() - 1;
+}
+
+void StatusPollScheduler::setBoosted(size_t request, bool boosted) {
+    Request& r = _requests[request];
+    if (boosted) {
+        r.boost = _boostHold + 1;
+    }
+}
+
+const std::vector<size_t>& StatusPollScheduler::schedule(uint32_t budget, size_t maxRequests) {
+    _scheduled.clear();
+    if (_requests.empty() || maxRequests == 0) {
+        return _scheduled;
+    }
+
+    for (auto& r : _requests) {
+        r.age++;
+    }
+
+    // stable order - for equal priority, lower index goes first
+    std::sort(_order.begin(), _order.end(), [this](size_t a, size_t b) {
+        uint64_t pa = _priority(_requests[a]);
+        uint64_t pb = _priority(_requests[b]);
+        return pa > pb || (pa == pb && a < b);
+    });
+
+    uint32_t remaining = budget;
+    for (auto i : _order) {
+        if (_scheduled.size() >= maxRequests) {
+            break;
+        }
+        if (_requests[i].cost <= remaining) {
+            _scheduled.push_back(i);
+            remaining -= _requests[i].cost;
+        }
+    }
+    if (_scheduled.empty()) {
+        _scheduled.push_back(_order[0]);
+    }
+
+    for (auto i : _scheduled) {
+        _requests[i].age = 0;
+    }
+    for (auto& r : _requests) {
+        if (r.boost > 0) {
+            r.boost--;
+        }
+    }
+    return _scheduled;
+}
+
+uint32_t StatusPollScheduler::getMinimalCost() const {
+    if (_requests.empty()) {
+        return 0;
+    }
+    return std::min_element(_requests.begin(), _requests.end(),
+                            [](const Request& a, const Request& b) { return a.cost < b.cost; })
+            ->cost;
+}
+
+uint64_t StatusPollScheduler::_priority(const Request& request) const {
+    uint64_t priority = request.age * PRIORITY_SCALE / request.period;
+    return request.boost > 0 ? priority * _boostFactor : priority;
+}
@@ -0,0 +1,123 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef STATUSPOLLSCHEDULER_H_
+#define STATUSPOLLSCHEDULER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Budgeted scheduler of low priority (status) requests. Every cycle selects
+ * requests to fit into the given wire time budget. Requests are ordered by
+ * priority - number of cycles since the request was last sent, divided by
+ * its desired period. Priority of boosted requests (ILCs with recent
+ * warnings) is multiplied by boost factor. Boost is held for configured
+ * number of cycles after the warning clears.
+ *
+ * As priority grows with age, all requests are eventually sent. At least one
+ * request is scheduled every cycle, even if it doesn't fit into the budget.
+ */
+class StatusPollScheduler {
+public:
+    /**
+     * Construct scheduler.
+     *
+     * @param boostFactor priority multiplier of boosted requests
+     * @param boostHold number of cycles the boost is kept after setBoosted(false)
+     */
+    StatusPollScheduler(uint32_t boostFactor = 4, uint32_t boostHold = 250);
+
+    /**
+     * Removes all requests.
+     */
+    void clear();
+
+    /**
+     * Adds request.
+     *
+     * @param cost request wire time (microseconds)
+     * @param period desired period (cycles) between requests
+     *
+     * @return request index
+     */
+    size_t addRequest(uint32_t cost, uint32_t period);
+
+    /**
+     * Sets request boost. Called before schedule when warning status of
+     * request ILC is known.
+     *
+     * @param request request index
+     * @param boosted true if request ILC has a warning
+     */
+    void setBoosted(size_t request, bool boosted);
+
+    /**
+     * Selects requests for the next cycle.
+     *
+     * @param budget wire time available for the requests (microseconds)
+     * @param maxRequests maximal number of selected requests
+     *
+     * @return indices of selected requests
+     */
+    const std::vector<size_t>& schedule(uint32_t budget, size_t maxRequests);
+
+    const std::vector<size_t>& getScheduled() const { return _scheduled; }
+
+    size_t size() const { return _requests.size(); }
+
+    /**
+     * Returns cost of the cheapest request.
+     *
+     * @return minimal cost, 0 if no request was added
+     */
+    uint32_t getMinimalCost() const;
+
+private:
+    struct Request {
+        uint32_t cost;
+        uint32_t period;
+        uint32_t age;  /// cycles since request was last scheduled
+        uint32_t boost;  /// remaining boost cycles
+    };
+
+    uint64_t _priority(const Request& request) const;
+
+    uint32_t _boostFactor;
+    uint32_t _boostHold;
+
+    std::vector<Request> _requests;
+    std::vector<size_t> _order;
+    std::vector<size_t> _scheduled;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* STATUSPOLLSCHEDULER_H_ */
@@ -26,6 +26,7 @@
 
 #include <string>
 #include <DataTypes.h>
+#include <CommandPool.h>
 
 namespace LSST {
 namespace M1M3 {
@@ -37,12 +38,18 @@ namespace SS {
  * Follows Command Pattern from Design Patterns. Encapsulates command executed
  * in M1M3 SS. Commands are created from SAL messages by
  * CommandFactory::create() and M1M3SSSubscriber in SubscriberThread::run().
+ *
+ * Commands memory is allocated from CommandPool, so creating and deleting
+ * commands doesn't use heap.
  */
 class Command {
 public:
     Command(int32_t commandID) : _commandID(commandID) {}
     virtual ~Command();
 
+    static void* operator new(size_t size) { return CommandPool::get().allocate(size); }
+    static void operator delete(void* ptr) { CommandPool::get().release(ptr); }
+
     /*!
      * Gets the command ID.
      */
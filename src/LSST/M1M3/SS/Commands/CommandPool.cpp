@@ -0,0 +1,80 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <CommandPool.h>
+#include <LimitLog.h>
+
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <new>
+#include <type_traits>
+
+using namespace std::chrono_literals;
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+CommandPool& CommandPool::get() {
+    // placement new into static storage - the pool is never destructed
+    static std::aligned_storage<sizeof(CommandPool), alignof(CommandPool)>::type storage;
+    static CommandPool* pool = new (&storage) CommandPool();
+    return *pool;
+}
+
+CommandPool::CommandPool() : _heapAllocations(0) {}
+
+void* CommandPool::allocate(size_t size) {
+    void* ret = nullptr;
+    if (size <= _small.slotSize()) {
+        ret = _small.allocate();
+    }
+    if (ret == nullptr && size <= _medium.slotSize()) {
+        ret = _medium.allocate();
+    }
+    if (ret == nullptr && size <= _large.slotSize()) {
+        ret = _large.allocate();
+    }
+    if (ret == nullptr) {
+        _heapAllocations++;
+        TG_LOG_WARN(60s, "CommandPool: no free slot for {} bytes command, using heap ({} heap allocations)",
+                    size, _heapAllocations);
+        ret = ::operator new(size);
+    }
+    return ret;
+}
+
+void CommandPool::release(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    if (_small.release(ptr) || _medium.release(ptr) || _large.release(ptr)) {
+        return;
+    }
+    ::operator delete(ptr);
+}
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
@@ -0,0 +1,149 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef COMMANDPOOL_H_
+#define COMMANDPOOL_H_
+
+#include <LockFreeQueue.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Fixed number of preallocated equally sized memory slots. Free slots are
+ * kept in a lock-free queue, so slots can be allocated and released from any
+ * thread without locking.
+ *
+ * @tparam SLOT_SIZE size of a single slot (bytes)
+ * @tparam SLOTS number of slots, must be power of 2
+ */
+template <size_t SLOT_SIZE, size_t SLOTS>
+class FixedPool {
+public:
+    FixedPool() {
+        for (size_t i = 0; i < SLOTS; i++) {
+            _free.push(_storage + i * SLOT_SIZE);
+        }
+    }
+
+    /**
+     * Returns free slot.
+     *
+     * @return pointer to free slot, nullptr if no slot is available
+     */
+    void* allocate() {
+        void* ret;
+        return _free.pop(ret) ? ret : nullptr;
+    }
+
+    /**
+     * Returns slot back into pool.
+     *
+     * @param ptr slot to release
+     *
+     * @return false if ptr doesn't belong to the pool
+     */
+    bool release(void* ptr) {
+        if (owns(ptr) == false) {
+            return false;
+        }
+        _free.push(ptr);
+        return true;
+    }
+
+    bool owns(void* ptr) const {
+        return ptr >= static_cast<const void*>(_storage) &&
+               ptr < static_cast<const void*>(_storage + SLOT_SIZE * SLOTS);
+    }
+
+    static constexpr size_t slotSize() { return SLOT_SIZE; }
+
+private:
+    alignas(alignof(std::max_align_t)) uint8_t _storage[SLOT_SIZE * SLOTS];
+    LockFreeQueue<void*, SLOTS> _free;
+};
+
+/**
+ * Preallocated memory for Command objects. Command::operator new and
+ * Command::operator delete use the pool, so steady state operation (periodic
+ * UpdateCommand, TMA samples and SAL commands) doesn't touch the heap. Slot
+ * of the smallest fitting size class is used. If no slot is available, heap
+ * is used as fallback.
+ */
+class CommandPool {
+public:
+    /**
+     * Returns singleton instance. The instance is never destroyed, so
+     * commands can be safely deleted from static destructors.
+     *
+     * @return pool instance
+     */
+    static CommandPool& get();
+
+    /**
+     * Allocates memory for command.
+     *
+     * @param size requested size (bytes)
+     *
+     * @return pointer to allocated memory
+     *
+     * @throw std::bad_alloc if heap fallback fails
+     */
+    void* allocate(size_t size);
+
+    /**
+     * Releases memory allocated with allocate.
+     *
+     * @param ptr memory to release
+     */
+    void release(void* ptr);
+
+    /**
+     * Returns number of allocations which weren't satisfied from the pool.
+     *
+     * @return number of heap allocations
+     */
+    uint64_t getHeapAllocations() { return _heapAllocations; }
+
+private:
+    CommandPool();
+    CommandPool& operator=(const CommandPool&) = delete;
+    CommandPool(const CommandPool&) = delete;
+
+    FixedPool<128, 32> _small;
+    FixedPool<1024, 64> _medium;
+    FixedPool<8192, 8> _large;
+
+    std::atomic<uint64_t> _heapAllocations;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* COMMANDPOOL_H_ */
@@ -23,6 +23,7 @@
 
 #include <Context.h>
 #include <UpdateCommand.h>
+#include <OuterLoopMonitor.h>
 
 namespace LSST {
 namespace M1M3 {
@@ -42,7 +43,10 @@ UpdateCommand::~UpdateCommand() {
     _updateMutex->unlock();
 }
 
-void UpdateCommand::execute() { Context::get().update(this); }
+void UpdateCommand::execute() {
+    OuterLoopMonitor::get().updateStarted();
+    Context::get().update(this);
+}
 
 } /* namespace SS */
 } /* namespace M1M3 */
@@ -307,6 +307,9 @@ void Context::enableAllForceActuators(EnableAllForceActuatorsCommand* command) {
 
 void Context::_updateCurrentStateIfRequired(States::Type potentialNewState) {
     if (potentialNewState != States::NoStateTransition) {
+        if (potentialNewState != _currentState) {
+            StaticStateFactory::get().create(_currentState)->leaveState();
+        }
         _currentState = potentialNewState;
         Model::get().publishStateChange(potentialNewState);
     }
@@ -92,7 +92,8 @@ ForceController::ForceController(ForceActuatorApplicationSettings* forceActuator
     for (int i = 0; i < FA_COUNT; i++) {
         _mirrorWeight += df.ZForces[i];
         _zero[i] = 0;
-        ForceActuatorIndicesNeighbors neighbors;
+        std::vector<int> nearIndices;
+        std::vector<int> farIndices;
         for (unsigned int j = 0; j < _forceActuatorSettings->Neighbors[i].NearZIDs.size(); ++j) {
             int index = _forceActuatorApplicationSettings->ActuatorIdToZIndex(
                     _forceActuatorSettings->Neighbors[i].NearZIDs[j]);
@@ -102,7 +103,7 @@ ForceController::ForceController(ForceActuatorApplicationSettings* forceActuator
                                 _forceActuatorApplicationSettings->ZIndexToActuatorId(i));
                 exit(EXIT_FAILURE);
             }
-            neighbors.NearZIndices.push_back(index);
+            nearIndices.push_back(index);
         }
         for (unsigned int j = 0; j < _forceActuatorSettings->Neighbors[i].FarIDs.size(); ++j) {
             int index = _forceActuatorApplicationSettings->ActuatorIdToZIndex(
@@ -113,9 +114,10 @@ ForceController::ForceController(ForceActuatorApplicationSettings* forceActuator
                                 _forceActuatorApplicationSettings->ZIndexToActuatorId(i));
                 exit(EXIT_FAILURE);
             }
-            neighbors.FarIndices.push_back(index);
+            farIndices.push_back(index);
         }
-        _neighbors.push_back(neighbors);
+        _nearNeighbors.addRow(nearIndices);
+        _farNeighbors.addRow(farIndices);
     }
 
     SPDLOG_INFO("ForceController mirror weight/all Z forces {}N", _mirrorWeight);
@@ -566,24 +568,20 @@ bool ForceController::_checkNearNeighbors() {
     bool warningChanged = false;
     _forceSetpointWarning->anyNearNeighborWarning = false;
     string failed;
+
+    float nearZ[FA_COUNT];
+    _nearNeighbors.gatherSum(_appliedForces->zForces, _zero, nearZ);
+
+    auto ilc = Model::get().getILC();
+    auto forceActuatorApplicationSettings = SettingReader::instance().getForceActuatorApplicationSettings();
     for (int zIndex = 0; zIndex < FA_COUNT; zIndex++) {
         // ignore check for disabled FA
-        if (Model::get().getILC()->isDisabled(
-                    SettingReader::instance().getForceActuatorApplicationSettings()->ZIndexToActuatorId(
-                            zIndex))) {
+        if (ilc->isDisabled(forceActuatorApplicationSettings->ZIndexToActuatorId(zIndex))) {
             continue;
         }
 
-        float nearZ = 0;
-        int nearNeighbors = _neighbors[zIndex].NearZIndices.size();
-        for (int j = 0; j < nearNeighbors; ++j) {
-            int neighborZIndex = _neighbors[zIndex].NearZIndices[j];
-
-            nearZ += _appliedForces->zForces[neighborZIndex];
-        }
-
-        nearZ /= nearNeighbors;
-        float deltaZ = abs(_appliedForces->zForces[zIndex] - nearZ);
+        float deltaZ =
+                abs(_appliedForces->zForces[zIndex] - nearZ[zIndex] / _nearNeighbors.getCount(zIndex));
 
         if (deltaZ > nominalZWarning) {
             _forceSetpointWarning->nearNeighborWarning[zIndex] = true;
@@ -641,49 +639,44 @@ bool ForceController::_checkFarNeighbors() {
     bool warningChanged = false;
     string failed;
     _forceSetpointWarning->anyFarNeighborWarning = false;
-    for (int zIndex = 0; zIndex < FA_COUNT; zIndex++) {
-        // ignore check for disabled FA
-        if (Model::get().getILC()->isDisabled(
-                    SettingReader::instance().getForceActuatorApplicationSettings()->ZIndexToActuatorId(
-                            zIndex))) {
-            continue;
-        }
 
+    // X and Y forces indexed by Z index, zero for actuators without X or Y
+    // cylinder. Sums start with the actuator own force.
+    float xForces[FA_COUNT];
+    float yForces[FA_COUNT];
+    double x[FA_COUNT];
+    double y[FA_COUNT];
+    double z[FA_COUNT];
+    for (int zIndex = 0; zIndex < FA_COUNT; zIndex++) {
         int xIndex = _forceActuatorApplicationSettings->ZIndexToXIndex[zIndex];
         int yIndex = _forceActuatorApplicationSettings->ZIndexToYIndex[zIndex];
-
-        double x = 0;
-        double y = 0;
-        double z = 0;
-        if (xIndex != -1) {
-            x = _appliedForces->xForces[xIndex];
-        }
-
-        if (yIndex != -1) {
-            y = _appliedForces->yForces[yIndex];
+        xForces[zIndex] = xIndex == -1 ? 0 : _appliedForces->xForces[xIndex];
+        yForces[zIndex] = yIndex == -1 ? 0 : _appliedForces->yForces[yIndex];
+        x[zIndex] = xForces[zIndex];
+        y[zIndex] = yForces[zIndex];
+        z[zIndex] = _appliedForces->zForces[zIndex];
+    }
+    _farNeighbors.gatherSum(xForces, x, x);
+    _farNeighbors.gatherSum(yForces, y, y);
+    _farNeighbors.gatherSum(_appliedForces->zForces, z, z);
+
+    auto ilc = Model::get().getILC();
+    auto forceActuatorApplicationSettings = SettingReader::instance().getForceActuatorApplicationSettings();
+    for (int zIndex = 0; zIndex < FA_COUNT; zIndex++) {
+        // ignore check for disabled FA
+        if (ilc->isDisabled(forceActuatorApplicationSettings->ZIndexToActuatorId(zIndex))) {
+            continue;
         }
 
-        z = _appliedForces->zForces[zIndex];
-        int farNeighbors = _neighbors[zIndex].FarIndices.size();
-        for (int j = 0; j < farNeighbors; ++j) {
-            int neighborZIndex = _neighbors[zIndex].FarIndices[j];
-            int neighborXIndex = _forceActuatorApplicationSettings->ZIndexToXIndex[neighborZIndex];
-            int neighborYIndex = _forceActuatorApplicationSettings->ZIndexToYIndex[neighborZIndex];
-
-            if (neighborXIndex != -1) {
-                x += _appliedForces->xForces[neighborXIndex];
-            }
-
-            if (neighborYIndex != -1) {
-                y += _appliedForces->yForces[neighborYIndex];
-            }
-
-            z += _appliedForces->zForces[neighborZIndex];
-        }
-        float magnitude = sqrt(x * x + y * y + z * z);
-        float magnitudeAverage = magnitude / (farNeighbors + 1.0);
+        // average magnitude has to be within tolerance of global average,
+        // compared as squares of the summed magnitude
+        double count = _farNeighbors.getCount(zIndex) + 1.0;
+        double magnitudeSquared = x[zIndex] * x[zIndex] + y[zIndex] * y[zIndex] + z[zIndex] * z[zIndex];
+        double low = (globalAverageForce - tolerance) * count;
+        double high = (globalAverageForce + tolerance) * count;
         bool previousWarning = _forceSetpointWarning->farNeighborWarning[zIndex];
-        if (!Range::InRange(-tolerance, tolerance, magnitudeAverage - globalAverageForce)) {
+        if (magnitudeSquared > high * high || (low > 0 && magnitudeSquared < low * low)) {
+            float magnitudeAverage = sqrt(magnitudeSquared) / count;
             failed += fmt::format(" {}: magA {:.2f} globalA {:.2f} |{:.2f}| < {:.2f}",
                                   _forceActuatorApplicationSettings->ZIndexToActuatorId(zIndex),
                                   magnitudeAverage, globalAverageForce, magnitudeAverage - globalAverageForce,
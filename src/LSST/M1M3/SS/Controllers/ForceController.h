@@ -46,6 +46,7 @@
 #include <ForceActuatorSettings.h>
 #include <SafetyController.h>
 #include <PIDSettings.h>
+#include <NeighborTable.h>
 
 #include <spdlog/spdlog.h>
 
@@ -53,11 +54,6 @@ namespace LSST {
 namespace M1M3 {
 namespace SS {
 
-struct ForceActuatorIndicesNeighbors {
-    std::vector<int32_t> NearZIndices;
-    std::vector<int32_t> FarIndices;
-};
-
 /**
  * Coordinate force actuators force calculcation. The mirror weight and
  * external forces acting on the mirror shall be counteracted by the force
@@ -278,7 +274,10 @@ private:
     MTM1M3_accelerometerDataC* _accelerometerData;
     MTM1M3_gyroDataC* _gyroData;
 
-    std::vector<ForceActuatorIndicesNeighbors> _neighbors;
+    /// near neighbors Z indices
+    NeighborTable _nearNeighbors;
+    /// far neighbors Z indices
+    NeighborTable _farNeighbors;
 
     float _zero[FA_COUNT];
     float _mirrorWeight;
@@ -495,6 +495,11 @@ void SafetyController::ilcCommunicationTimeout(bool conditionFlag) {
                     "ILC communication timeouted: {}", sum);
 }
 
+void SafetyController::outerLoopDeadlineMiss(bool conditionFlag, uint32_t consecutiveMisses) {
+    _updateOverride(FaultCodes::OuterLoopDeadlineMiss, true, conditionFlag,
+                    "Outer loop missed {} consecutive deadlines", consecutiveMisses);
+}
+
 void SafetyController::forceActuatorFollowingError(int actuatorDataIndex, bool conditionFlag) {
     _forceActuatorFollowingErrorData[actuatorDataIndex].pop_front();
     _forceActuatorFollowingErrorData[actuatorDataIndex].push_back(conditionFlag ? 1 : 0);
@@ -128,6 +128,14 @@ public:
 
     void ilcCommunicationTimeout(bool conditionFlag);
 
+    /**
+     * Called when outer loop clock ticks were missed.
+     *
+     * @param conditionFlag true if number of consecutive misses reached fault threshold
+     * @param consecutiveMisses number of consecutive late clock ticks
+     */
+    void outerLoopDeadlineMiss(bool conditionFlag, uint32_t consecutiveMisses);
+
     void forceActuatorFollowingError(int actuatorDataIndex, bool conditionFlag);
 
     void hardpointActuatorLoadCellError(bool conditionFlag);
@@ -27,6 +27,7 @@
 #include <unistd.h>
 #include <U8ArrayUtilities.h>
 #include <FPGAAddresses.h>
+#include <DataTypes.h>
 
 #include <iostream>
 #include <iomanip>
@@ -123,6 +124,38 @@ void FPGA::ackModbusIRQ(int32_t subnet) {
     }
 }
 
+uint8_t FPGA::waitForAnyModbusIRQ(uint8_t subnets, uint32_t timeout) {
+    uint32_t irqs = 0;
+    // subnets without interrupt are always ready
+    uint8_t ready = 0;
+    for (int subnet = 1; subnet <= SUBNET_COUNT; subnet++) {
+        uint8_t mask = 1 << (subnet - 1);
+        if ((subnets & mask) == 0) {
+            continue;
+        }
+        uint32_t irq = getIrq(subnet);
+        if (irq == 0) {
+            ready |= mask;
+        }
+        irqs |= irq;
+    }
+    if (ready != 0 || irqs == 0) {
+        return ready;
+    }
+
+    uint32_t assertedIRQs = 0;
+    NiFpga_Bool timedOut = false;
+    NiThrowError(__PRETTY_FUNCTION__,
+                 NiFpga_WaitOnIrqs(_session, _modbusIRQContext, irqs, timeout, &assertedIRQs, &timedOut));
+    for (int subnet = 1; subnet <= SUBNET_COUNT; subnet++) {
+        uint8_t mask = 1 << (subnet - 1);
+        if ((subnets & mask) && (assertedIRQs & getIrq(subnet))) {
+            ready |= mask;
+        }
+    }
+    return ready;
+}
+
 void FPGA::pullTelemetry() {
     SPDLOG_TRACE("FPGA: pullTelemetry()");
     cRIO::FPGA::writeRequestFIFO(FPGAAddresses::Telemetry, 0);
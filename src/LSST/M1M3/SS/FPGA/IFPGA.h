@@ -129,6 +129,20 @@ public:
      */
     virtual void ackModbusIRQ(int32_t subnet) = 0;
 
+    /**
+     * Wait for any of the subnets ModBus interrupts. Returns as soon as at
+     * least one of the interrupts is raised. Interrupts are not acknowledged.
+     *
+     * @param subnets bit mask of subnets to wait for (bit 0 for subnet 1, bit
+     * 4 for subnet 5)
+     * @param timeout timeout in microseconds
+     *
+     * @return bit mask of subnets with raised interrupt, 0 on timeout
+     *
+     * @throw NiError on NI error
+     */
+    virtual uint8_t waitForAnyModbusIRQ(uint8_t subnets, uint32_t timeout) = 0;
+
     /**
      * Retrieve telemetry data.
      *
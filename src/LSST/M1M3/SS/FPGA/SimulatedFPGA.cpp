@@ -124,6 +124,8 @@ void SimulatedFPGA::waitForModbusIRQ(int32_t subnet, uint32_t timeout) {}
 
 void SimulatedFPGA::ackModbusIRQ(int32_t subnet) {}
 
+uint8_t SimulatedFPGA::waitForAnyModbusIRQ(uint8_t subnets, uint32_t timeout) { return subnets; }
+
 void SimulatedFPGA::pullTelemetry() {
     SPDLOG_TRACE("SimulatedFPGA: pullTelemetry()");
     uint64_t timestamp = Timestamp::toRaw(M1M3SSPublisher::get().getTimestamp());
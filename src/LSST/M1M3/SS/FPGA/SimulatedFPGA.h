@@ -68,6 +68,7 @@ public:
 
     void waitForModbusIRQ(int32_t subnet, uint32_t timeout) override;
     void ackModbusIRQ(int32_t subnet) override;
+    uint8_t waitForAnyModbusIRQ(uint8_t subnets, uint32_t timeout) override;
 
     void pullTelemetry() override;
     void pullHealthAndStatus() override;
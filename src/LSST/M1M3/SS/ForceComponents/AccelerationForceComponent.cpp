@@ -47,6 +47,7 @@ AccelerationForceComponent::AccelerationForceComponent(
     _forceSetpointWarning = M1M3SSPublisher::get().getEventForceSetpointWarning();
     _appliedAccelerationForces = M1M3SSPublisher::get().getAppliedAccelerationForces();
     _preclippedAccelerationForces = M1M3SSPublisher::get().getEventPreclippedAccelerationForces();
+    _clippingRequired = false;
 }
 
 void AccelerationForceComponent::applyAccelerationForces(float* x, float* y, float* z) {
@@ -176,6 +177,8 @@ void AccelerationForceComponent::postUpdateActions() {
 
     _safetyController->forceControllerNotifyAccelerationForceClipping(clippingRequired);
 
+    _clippingRequired = clippingRequired;
+
     M1M3SSPublisher::get().tryLogForceSetpointWarning();
     if (clippingRequired) {
         M1M3SSPublisher::get().logPreclippedAccelerationForces();
@@ -183,6 +186,15 @@ void AccelerationForceComponent::postUpdateActions() {
     M1M3SSPublisher::get().logAppliedAccelerationForces();
 }
 
+void AccelerationForceComponent::postUnchangedActions() {
+    SPDLOG_TRACE("AccelerationForceController: postUnchangedActions()");
+
+    republishUnchanged(_safetyController, &SafetyController::forceControllerNotifyAccelerationForceClipping,
+                       _clippingRequired, _appliedAccelerationForces, _preclippedAccelerationForces,
+                       &M1M3SSPublisher::logAppliedAccelerationForces,
+                       &M1M3SSPublisher::logPreclippedAccelerationForces);
+}
+
 } /* namespace SS */
 } /* namespace M1M3 */
 } /* namespace LSST */
@@ -57,6 +57,7 @@ public:
 protected:
     void postEnableDisableActions() override;
     void postUpdateActions() override;
+    void postUnchangedActions() override;
 
 private:
     SafetyController* _safetyController;
@@ -67,6 +68,9 @@ private:
     MTM1M3_logevent_forceSetpointWarningC* _forceSetpointWarning;
     MTM1M3_appliedAccelerationForcesC* _appliedAccelerationForces;
     MTM1M3_logevent_preclippedAccelerationForcesC* _preclippedAccelerationForces;
+
+    /// clipping result of the last postUpdateActions call
+    bool _clippingRequired;
 };
 
 } /* namespace SS */
@@ -48,6 +48,7 @@ AzimuthForceComponent::AzimuthForceComponent(
     _forceSetpointWarning = M1M3SSPublisher::get().getEventForceSetpointWarning();
     _appliedAzimuthForces = M1M3SSPublisher::get().getAppliedAzimuthForces();
     _preclippedAzimuthForces = M1M3SSPublisher::get().getEventPreclippedAzimuthForces();
+    _clippingRequired = false;
 }
 
 void AzimuthForceComponent::applyAzimuthForces(float* x, float* y, float* z) {
@@ -173,6 +174,8 @@ void AzimuthForceComponent::postUpdateActions() {
 
     _safetyController->forceControllerNotifyAzimuthForceClipping(clippingRequired);
 
+    _clippingRequired = clippingRequired;
+
     M1M3SSPublisher::get().tryLogForceSetpointWarning();
     if (clippingRequired) {
         M1M3SSPublisher::get().logPreclippedAzimuthForces();
@@ -180,6 +183,15 @@ void AzimuthForceComponent::postUpdateActions() {
     M1M3SSPublisher::get().logAppliedAzimuthForces();
 }
 
+void AzimuthForceComponent::postUnchangedActions() {
+    SPDLOG_TRACE("AzimuthForceController: postUnchangedActions()");
+
+    republishUnchanged(_safetyController, &SafetyController::forceControllerNotifyAzimuthForceClipping,
+                       _clippingRequired, _appliedAzimuthForces, _preclippedAzimuthForces,
+                       &M1M3SSPublisher::logAppliedAzimuthForces,
+                       &M1M3SSPublisher::logPreclippedAzimuthForces);
+}
+
 }  // namespace SS
 }  // namespace M1M3
 } /* namespace LSST */
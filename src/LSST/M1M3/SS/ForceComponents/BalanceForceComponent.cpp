@@ -55,6 +55,7 @@ BalanceForceComponent::BalanceForceComponent(
     _forceSetpointWarning = M1M3SSPublisher::get().getEventForceSetpointWarning();
     _appliedBalanceForces = M1M3SSPublisher::get().getAppliedBalanceForces();
     _preclippedBalanceForces = M1M3SSPublisher::get().getEventPreclippedBalanceForces();
+    _clippingRequired = false;
 }
 
 void BalanceForceComponent::applyBalanceForces(float* x, float* y, float* z) {
@@ -220,6 +221,8 @@ void BalanceForceComponent::postUpdateActions() {
 
     _safetyController->forceControllerNotifyBalanceForceClipping(clippingRequired);
 
+    _clippingRequired = clippingRequired;
+
     M1M3SSPublisher::get().tryLogForceSetpointWarning();
     if (clippingRequired) {
         M1M3SSPublisher::get().logPreclippedBalanceForces();
@@ -246,6 +249,15 @@ PID* BalanceForceComponent::_idToPID(int id) {
     }
 }
 
+void BalanceForceComponent::postUnchangedActions() {
+    SPDLOG_TRACE("BalanceForceController: postUnchangedActions()");
+
+    republishUnchanged(_safetyController, &SafetyController::forceControllerNotifyBalanceForceClipping,
+                       _clippingRequired, _appliedBalanceForces, _preclippedBalanceForces,
+                       &M1M3SSPublisher::logAppliedBalanceForces,
+                       &M1M3SSPublisher::logPreclippedBalanceForces);
+}
+
 } /* namespace SS */
 } /* namespace M1M3 */
 } /* namespace LSST */
@@ -81,6 +81,7 @@ public:
 protected:
     void postEnableDisableActions() override;
     void postUpdateActions() override;
+    void postUnchangedActions() override;
 
 private:
     PID* _idToPID(int id);
@@ -101,6 +102,9 @@ private:
     MTM1M3_logevent_forceSetpointWarningC* _forceSetpointWarning;
     MTM1M3_appliedBalanceForcesC* _appliedBalanceForces;
     MTM1M3_logevent_preclippedBalanceForcesC* _preclippedBalanceForces;
+
+    /// clipping result of the last postUpdateActions call
+    bool _clippingRequired;
 };
 
 } /* namespace SS */
@@ -48,6 +48,7 @@ ElevationForceComponent::ElevationForceComponent(
     _forceSetpointWarning = M1M3SSPublisher::get().getEventForceSetpointWarning();
     _appliedElevationForces = M1M3SSPublisher::get().getAppliedElevationForces();
     _preclippedElevationForces = M1M3SSPublisher::get().getEventPreclippedElevationForces();
+    _clippingRequired = false;
 }
 
 void ElevationForceComponent::applyElevationForces(float* x, float* y, float* z) {
@@ -176,6 +177,8 @@ void ElevationForceComponent::postUpdateActions() {
 
     _safetyController->forceControllerNotifyElevationForceClipping(clippingRequired);
 
+    _clippingRequired = clippingRequired;
+
     M1M3SSPublisher::get().tryLogForceSetpointWarning();
     if (clippingRequired) {
         M1M3SSPublisher::get().logPreclippedElevationForces();
@@ -183,6 +186,15 @@ void ElevationForceComponent::postUpdateActions() {
     M1M3SSPublisher::get().logAppliedElevationForces();
 }
 
+void ElevationForceComponent::postUnchangedActions() {
+    SPDLOG_TRACE("ElevationForceController: postUnchangedActions()");
+
+    republishUnchanged(_safetyController, &SafetyController::forceControllerNotifyElevationForceClipping,
+                       _clippingRequired, _appliedElevationForces, _preclippedElevationForces,
+                       &M1M3SSPublisher::logAppliedElevationForces,
+                       &M1M3SSPublisher::logPreclippedElevationForces);
+}
+
 } /* namespace SS */
 } /* namespace M1M3 */
 } /* namespace LSST */
@@ -51,6 +51,7 @@ public:
 protected:
     void postEnableDisableActions() override;
     void postUpdateActions() override;
+    void postUnchangedActions() override;
 
 private:
     SafetyController* _safetyController;
@@ -61,6 +62,9 @@ private:
     MTM1M3_logevent_forceSetpointWarningC* _forceSetpointWarning;
     MTM1M3_appliedElevationForcesC* _appliedElevationForces;
     MTM1M3_logevent_preclippedElevationForcesC* _preclippedElevationForces;
+
+    /// clipping result of the last postUpdateActions call
+    bool _clippingRequired;
 };
 
 } /* namespace SS */
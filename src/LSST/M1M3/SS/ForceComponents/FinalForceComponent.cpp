@@ -29,8 +29,10 @@
 #include <ForceActuatorSettings.h>
 #include <Range.h>
 #include <ForcesAndMoments.h>
-#include <ForceConverter.h>
 #include <DistributedForces.h>
+#include <cmath>
+#include <cstring>
+
 #include <spdlog/spdlog.h>
 
 namespace LSST {
@@ -48,6 +50,7 @@ FinalForceComponent::FinalForceComponent(ForceActuatorApplicationSettings* force
     _forceSetpointWarning = M1M3SSPublisher::get().getEventForceSetpointWarning();
     _appliedForces = M1M3SSPublisher::get().getAppliedForces();
     _preclippedForces = M1M3SSPublisher::get().getEventPreclippedForces();
+    _clippingRequired = false;
 
     _appliedAccelerationForces = M1M3SSPublisher::get().getAppliedAccelerationForces();
     _appliedActiveOpticForces = M1M3SSPublisher::get().getEventAppliedActiveOpticForces();
@@ -59,6 +62,43 @@ FinalForceComponent::FinalForceComponent(ForceActuatorApplicationSettings* force
     _appliedThermalForces = M1M3SSPublisher::get().getAppliedThermalForces();
     _appliedVelocityForces = M1M3SSPublisher::get().getAppliedVelocityForces();
 
+    _xComponents[0] = _appliedAccelerationForces->xForces;
+    _xComponents[1] = _appliedAzimuthForces->xForces;
+    _xComponents[2] = _appliedBalanceForces->xForces;
+    _xComponents[3] = _appliedElevationForces->xForces;
+    _xComponents[4] = _appliedOffsetForces->xForces;
+    _xComponents[5] = _appliedStaticForces->xForces;
+    _xComponents[6] = _appliedThermalForces->xForces;
+    _xComponents[7] = _appliedVelocityForces->xForces;
+
+    _yComponents[0] = _appliedAccelerationForces->yForces;
+    _yComponents[1] = _appliedAzimuthForces->yForces;
+    _yComponents[2] = _appliedBalanceForces->yForces;
+    _yComponents[3] = _appliedElevationForces->yForces;
+    _yComponents[4] = _appliedOffsetForces->yForces;
+    _yComponents[5] = _appliedStaticForces->yForces;
+    _yComponents[6] = _appliedThermalForces->yForces;
+    _yComponents[7] = _appliedVelocityForces->yForces;
+
+    _zComponents[0] = _appliedAccelerationForces->zForces;
+    _zComponents[1] = _appliedActiveOpticForces->zForces;
+    _zComponents[2] = _appliedAzimuthForces->zForces;
+    _zComponents[3] = _appliedBalanceForces->zForces;
+    _zComponents[4] = _appliedElevationForces->zForces;
+    _zComponents[5] = _appliedOffsetForces->zForces;
+    _zComponents[6] = _appliedStaticForces->zForces;
+    _zComponents[7] = _appliedThermalForces->zForces;
+    _zComponents[8] = _appliedVelocityForces->zForces;
+
+    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
+        _rx[zIndex] = _forceActuatorApplicationSettings->Table[zIndex].XPosition -
+                      _forceActuatorSettings->mirrorCenterOfGravityX;
+        _ry[zIndex] = _forceActuatorApplicationSettings->Table[zIndex].YPosition -
+                      _forceActuatorSettings->mirrorCenterOfGravityY;
+        _rz[zIndex] = _forceActuatorApplicationSettings->Table[zIndex].ZPosition -
+                      _forceActuatorSettings->mirrorCenterOfGravityZ;
+    }
+
     enable();
 }
 
@@ -69,40 +109,43 @@ void FinalForceComponent::applyForcesByComponents() {
         enable();
     }
 
-    for (int i = 0; i < FA_COUNT; ++i) {
-        if (i < 12) {
-            int zIndex = _forceActuatorApplicationSettings->XIndexToZIndex[i];
-
-            if (_enabledForceActuators->forceActuatorEnabled[zIndex] == true) {
-                xTarget[i] = (_appliedAccelerationForces->xForces[i] + _appliedAzimuthForces->xForces[i] +
-                              _appliedBalanceForces->xForces[i] + _appliedElevationForces->xForces[i] +
-                              _appliedOffsetForces->xForces[i] + _appliedStaticForces->xForces[i] +
-                              _appliedThermalForces->xForces[i] + _appliedVelocityForces->xForces[i]);
-            } else {
-                xTarget[i] = 0;
-            }
-        }
+    // Components are summed one after the other, so inner loops run over
+    // contiguous actuator arrays. Summation order is kept, so the result is
+    // identical to summing all components of an actuator in one expression.
+    memset(xTarget, 0, sizeof(float) * FA_X_COUNT);
+    memset(yTarget, 0, sizeof(float) * FA_Y_COUNT);
+    memset(zTarget, 0, sizeof(float) * FA_Z_COUNT);
 
-        if (i < 100) {
-            int zIndex = _forceActuatorApplicationSettings->YIndexToZIndex[i];
-
-            if (_enabledForceActuators->forceActuatorEnabled[zIndex] == true) {
-                yTarget[i] = (_appliedAccelerationForces->yForces[i] + _appliedAzimuthForces->yForces[i] +
-                              _appliedBalanceForces->yForces[i] + _appliedElevationForces->yForces[i] +
-                              _appliedOffsetForces->yForces[i] + _appliedStaticForces->yForces[i] +
-                              _appliedThermalForces->yForces[i] + _appliedVelocityForces->yForces[i]);
-            } else {
-                yTarget[i] = 0;
-            }
+    for (int c = 0; c < XY_COMPONENTS; ++c) {
+        const float* xForces = _xComponents[c];
+        for (int i = 0; i < FA_X_COUNT; ++i) {
+            xTarget[i] += xForces[i];
+        }
+        const float* yForces = _yComponents[c];
+        for (int i = 0; i < FA_Y_COUNT; ++i) {
+            yTarget[i] += yForces[i];
+        }
+    }
+    for (int c = 0; c < Z_COMPONENTS; ++c) {
+        const float* zForces = _zComponents[c];
+        for (int i = 0; i < FA_Z_COUNT; ++i) {
+            zTarget[i] += zForces[i];
         }
+    }
 
-        if (_enabledForceActuators->forceActuatorEnabled[i] == true) {
-            zTarget[i] = (_appliedAccelerationForces->zForces[i] + _appliedActiveOpticForces->zForces[i] +
-                          _appliedAzimuthForces->zForces[i] + _appliedBalanceForces->zForces[i] +
-                          _appliedElevationForces->zForces[i] + _appliedOffsetForces->zForces[i] +
-                          _appliedStaticForces->zForces[i] + _appliedThermalForces->zForces[i] +
-                          _appliedVelocityForces->zForces[i]);
-        } else {
+    auto enabled = _enabledForceActuators->forceActuatorEnabled;
+    for (int i = 0; i < FA_X_COUNT; ++i) {
+        if (enabled[_forceActuatorApplicationSettings->XIndexToZIndex[i]] == false) {
+            xTarget[i] = 0;
+        }
+    }
+    for (int i = 0; i < FA_Y_COUNT; ++i) {
+        if (enabled[_forceActuatorApplicationSettings->YIndexToZIndex[i]] == false) {
+            yTarget[i] = 0;
+        }
+    }
+    for (int i = 0; i < FA_Z_COUNT; ++i) {
+        if (enabled[i] == false) {
             zTarget[i] = 0;
         }
     }
@@ -115,70 +158,83 @@ void FinalForceComponent::postEnableDisableActions() {
 void FinalForceComponent::postUpdateActions() {
     SPDLOG_TRACE("FinalForceController: postUpdateActions()");
 
-    bool notInRange = false;
     bool clippingRequired = false;
     _appliedForces->timestamp = M1M3SSPublisher::get().getTimestamp();
     _preclippedForces->timestamp = _appliedForces->timestamp;
+
+    // clipping, warning flags and applied and preclipped forces and moments
+    // are calculated in a single sweep
+    ForcesAndMoments applied = {0, 0, 0, 0, 0, 0, 0};
+    ForcesAndMoments preclipped = {0, 0, 0, 0, 0, 0, 0};
+
     for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
         int xIndex = _forceActuatorApplicationSettings->ZIndexToXIndex[zIndex];
         int yIndex = _forceActuatorApplicationSettings->ZIndexToYIndex[zIndex];
 
-        _forceSetpointWarning->forceWarning[zIndex] = false;
+        bool notInRange = false;
+        float xPreclipped = 0;
+        float yPreclipped = 0;
+        float xApplied = 0;
+        float yApplied = 0;
 
         if (xIndex != -1) {
             float xLowFault = _forceActuatorSettings->ForceLimitXTable[xIndex].LowFault;
             float xHighFault = _forceActuatorSettings->ForceLimitXTable[xIndex].HighFault;
-            _preclippedForces->xForces[xIndex] = xCurrent[xIndex];
-            notInRange = !Range::InRangeAndCoerce(xLowFault, xHighFault, _preclippedForces->xForces[xIndex],
+            xPreclipped = xCurrent[xIndex];
+            _preclippedForces->xForces[xIndex] = xPreclipped;
+            notInRange = !Range::InRangeAndCoerce(xLowFault, xHighFault, xPreclipped,
                                                   _appliedForces->xForces + xIndex);
-            _forceSetpointWarning->forceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->forceWarning[zIndex];
+            xApplied = _appliedForces->xForces[xIndex];
         }
 
         if (yIndex != -1) {
             float yLowFault = _forceActuatorSettings->ForceLimitYTable[yIndex].LowFault;
             float yHighFault = _forceActuatorSettings->ForceLimitYTable[yIndex].HighFault;
-            _preclippedForces->yForces[yIndex] = yCurrent[yIndex];
-            notInRange = !Range::InRangeAndCoerce(yLowFault, yHighFault, _preclippedForces->yForces[yIndex],
-                                                  _appliedForces->yForces + yIndex);
-            _forceSetpointWarning->forceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->forceWarning[zIndex];
+            yPreclipped = yCurrent[yIndex];
+            _preclippedForces->yForces[yIndex] = yPreclipped;
+            notInRange = !Range::InRangeAndCoerce(yLowFault, yHighFault, yPreclipped,
+                                                  _appliedForces->yForces + yIndex) ||
+                         notInRange;
+            yApplied = _appliedForces->yForces[yIndex];
         }
 
         float zLowFault = _forceActuatorSettings->ForceLimitZTable[zIndex].LowFault;
         float zHighFault = _forceActuatorSettings->ForceLimitZTable[zIndex].HighFault;
-        _preclippedForces->zForces[zIndex] = zCurrent[zIndex];
-        notInRange = !Range::InRangeAndCoerce(zLowFault, zHighFault, _preclippedForces->zForces[zIndex],
-                                              _appliedForces->zForces + zIndex);
-        _forceSetpointWarning->forceWarning[zIndex] =
-                notInRange || _forceSetpointWarning->forceWarning[zIndex];
-        clippingRequired = _forceSetpointWarning->forceWarning[zIndex] || clippingRequired;
+        float zPreclipped = zCurrent[zIndex];
+        _preclippedForces->zForces[zIndex] = zPreclipped;
+        notInRange = !Range::InRangeAndCoerce(zLowFault, zHighFault, zPreclipped,
+                                              _appliedForces->zForces + zIndex) ||
+                     notInRange;
+
+        _forceSetpointWarning->forceWarning[zIndex] = notInRange;
+        clippingRequired = notInRange || clippingRequired;
+
+        _addForcesAndMoments(applied, zIndex, xApplied, yApplied, _appliedForces->zForces[zIndex]);
+        _addForcesAndMoments(preclipped, zIndex, xPreclipped, yPreclipped, zPreclipped);
     }
 
-    ForcesAndMoments fm = ForceConverter::calculateForcesAndMoments(
-            _forceActuatorApplicationSettings, _forceActuatorSettings, _appliedForces->xForces,
-            _appliedForces->yForces, _appliedForces->zForces);
-    _appliedForces->fx = fm.Fx;
-    _appliedForces->fy = fm.Fy;
-    _appliedForces->fz = fm.Fz;
-    _appliedForces->mx = fm.Mx;
-    _appliedForces->my = fm.My;
-    _appliedForces->mz = fm.Mz;
-    _appliedForces->forceMagnitude = fm.ForceMagnitude;
-
-    fm = ForceConverter::calculateForcesAndMoments(_forceActuatorApplicationSettings, _forceActuatorSettings,
-                                                   _preclippedForces->xForces, _preclippedForces->yForces,
-                                                   _preclippedForces->zForces);
-    _preclippedForces->fx = fm.Fx;
-    _preclippedForces->fy = fm.Fy;
-    _preclippedForces->fz = fm.Fz;
-    _preclippedForces->mx = fm.Mx;
-    _preclippedForces->my = fm.My;
-    _preclippedForces->mz = fm.Mz;
-    _preclippedForces->forceMagnitude = fm.ForceMagnitude;
+    _appliedForces->fx = applied.Fx;
+    _appliedForces->fy = applied.Fy;
+    _appliedForces->fz = applied.Fz;
+    _appliedForces->mx = applied.Mx;
+    _appliedForces->my = applied.My;
+    _appliedForces->mz = applied.Mz;
+    _appliedForces->forceMagnitude =
+            sqrt(applied.Fx * applied.Fx + applied.Fy * applied.Fy + applied.Fz * applied.Fz);
+
+    _preclippedForces->fx = preclipped.Fx;
+    _preclippedForces->fy = preclipped.Fy;
+    _preclippedForces->fz = preclipped.Fz;
+    _preclippedForces->mx = preclipped.Mx;
+    _preclippedForces->my = preclipped.My;
+    _preclippedForces->mz = preclipped.Mz;
+    _preclippedForces->forceMagnitude = sqrt(preclipped.Fx * preclipped.Fx + preclipped.Fy * preclipped.Fy +
+                                             preclipped.Fz * preclipped.Fz);
 
     _safetyController->forceControllerNotifyForceClipping(clippingRequired);
 
+    _clippingRequired = clippingRequired;
+
     M1M3SSPublisher::get().tryLogForceSetpointWarning();
     if (clippingRequired) {
         M1M3SSPublisher::get().logPreclippedForces();
@@ -186,6 +242,24 @@ void FinalForceComponent::postUpdateActions() {
     M1M3SSPublisher::get().logAppliedForces();
 }
 
+void FinalForceComponent::postUnchangedActions() {
+    SPDLOG_TRACE("FinalForceController: postUnchangedActions()");
+
+    republishUnchanged(_safetyController, &SafetyController::forceControllerNotifyForceClipping,
+                       _clippingRequired, _appliedForces, _preclippedForces,
+                       &M1M3SSPublisher::logAppliedForces, &M1M3SSPublisher::logPreclippedForces);
+}
+
+void FinalForceComponent::_addForcesAndMoments(ForcesAndMoments& fm, int zIndex, float fx, float fy,
+                                                float fz) {
+    fm.Fx += fx;
+    fm.Fy += fy;
+    fm.Fz += fz;
+    fm.Mx += (fz * _ry[zIndex]) - (fy * _rz[zIndex]);
+    fm.My += (fx * _rz[zIndex]) - (fz * _rx[zIndex]);
+    fm.Mz += (fy * _rx[zIndex]) - (fx * _ry[zIndex]);
+}
+
 } /* namespace SS */
 } /* namespace M1M3 */
 } /* namespace LSST */
@@ -28,6 +28,7 @@
 #include <ForceComponent.h>
 #include <ForceActuatorApplicationSettings.h>
 #include <ForceActuatorSettings.h>
+#include <ForcesAndMoments.h>
 #include <SafetyController.h>
 #include <SAL_MTM1M3C.h>
 
@@ -60,8 +61,16 @@ public:
 protected:
     void postEnableDisableActions() override;
     void postUpdateActions() override;
+    void postUnchangedActions() override;
 
 private:
+    /**
+     * Adds actuator force contribution to mirror forces and moments.
+     * Equivalent to ForceConverter::calculateForcesAndMoments inner loop,
+     * with moment arms precalculated in the constructor.
+     */
+    void _addForcesAndMoments(ForcesAndMoments& fm, int zIndex, float fx, float fy, float fz);
+
     SafetyController* _safetyController;
     EnabledForceActuators* _enabledForceActuators;
     ForceActuatorApplicationSettings* _forceActuatorApplicationSettings;
@@ -72,6 +81,9 @@ private:
     MTM1M3_appliedForcesC* _appliedForces;
     MTM1M3_logevent_preclippedForcesC* _preclippedForces;
 
+    /// clipping result of the last postUpdateActions call
+    bool _clippingRequired;
+
     MTM1M3_appliedAccelerationForcesC* _appliedAccelerationForces;
     MTM1M3_logevent_appliedActiveOpticForcesC* _appliedActiveOpticForces;
     MTM1M3_appliedAzimuthForcesC* _appliedAzimuthForces;
@@ -81,6 +93,18 @@ private:
     MTM1M3_logevent_appliedStaticForcesC* _appliedStaticForces;
     MTM1M3_appliedThermalForcesC* _appliedThermalForces;
     MTM1M3_appliedVelocityForcesC* _appliedVelocityForces;
+
+    // component forces summed into target, in the summation order
+    static constexpr int XY_COMPONENTS = 8;
+    static constexpr int Z_COMPONENTS = 9;
+    const float* _xComponents[XY_COMPONENTS];
+    const float* _yComponents[XY_COMPONENTS];
+    const float* _zComponents[Z_COMPONENTS];
+
+    // actuator moment arms relative to mirror center of gravity
+    float _rx[FA_COUNT];
+    float _ry[FA_COUNT];
+    float _rz[FA_COUNT];
 };
 
 } /* namespace SS */
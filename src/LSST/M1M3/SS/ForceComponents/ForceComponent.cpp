@@ -23,6 +23,7 @@
 
 #include <ForceComponent.h>
 #include <cstring>
+#include <algorithm>
 #include <cmath>
 #include <spdlog/spdlog.h>
 
@@ -35,16 +36,11 @@ ForceComponent::ForceComponent(const char *name, const ForceComponentSettings &f
           _maxRateOfChange(forceComponentSettings.MaxRateOfChange),
           _nearZeroValue(forceComponentSettings.NearZeroValue) {
     _state = DISABLED;
+    _published = false;
 
-    memset(xCurrent, 0, sizeof(xCurrent));
-    memset(yCurrent, 0, sizeof(yCurrent));
-    memset(zCurrent, 0, sizeof(zCurrent));
-    memset(xTarget, 0, sizeof(xTarget));
-    memset(yTarget, 0, sizeof(yTarget));
-    memset(zTarget, 0, sizeof(zTarget));
-    memset(xOffset, 0, sizeof(xOffset));
-    memset(yOffset, 0, sizeof(yOffset));
-    memset(zOffset, 0, sizeof(zOffset));
+    memset(_current, 0, sizeof(_current));
+    memset(_target, 0, sizeof(_target));
+    memset(_offset, 0, sizeof(_offset));
 }
 
 ForceComponent::~ForceComponent() {}
@@ -53,9 +49,8 @@ void ForceComponent::enable() {
     // Enable and set the target to 0N
     SPDLOG_DEBUG("{}ForceComponent: enable()", _name);
     _state = ENABLED;
-    memset(xTarget, 0, sizeof(xTarget));
-    memset(yTarget, 0, sizeof(yTarget));
-    memset(zTarget, 0, sizeof(zTarget));
+    _published = false;
+    memset(_target, 0, sizeof(_target));
     postEnableDisableActions();
 }
 
@@ -63,120 +58,93 @@ void ForceComponent::disable() {
     // Start disabling and driving to 0N
     SPDLOG_DEBUG("{}ForceComponent: disable()", _name);
     _state = DISABLING;
-    memset(xTarget, 0, sizeof(xTarget));
-    memset(yTarget, 0, sizeof(yTarget));
-    memset(zTarget, 0, sizeof(zTarget));
+    memset(_target, 0, sizeof(_target));
 }
 
 void ForceComponent::update() {
-    if (isDisabling()) {
-        // If we are disabling we need to keep driving this force component to 0N
-        // Once we are near zero we consider our action complete and that the force
-        // component is actually disabled
-        bool nearZero = true;
-        for (int i = 0; i < FA_COUNT && nearZero; ++i) {
-            if (i < FA_X_COUNT) {
-                nearZero = nearZero && fabs(xCurrent[i]) < _nearZeroValue;
-            }
-
-            if (i < FA_Y_COUNT) {
-                nearZero = nearZero && fabs(yCurrent[i]) < _nearZeroValue;
-            }
-
-            nearZero = nearZero && fabs(zCurrent[i]) < _nearZeroValue;
-        }
-        if (nearZero) {
-            SPDLOG_DEBUG("{}ForceComponent: disabled()", _name);
-            _state = DISABLED;
-            memset(xCurrent, 0, sizeof(xCurrent));
-            memset(yCurrent, 0, sizeof(yCurrent));
-            memset(zCurrent, 0, sizeof(zCurrent));
-            postEnableDisableActions();
-            postUpdateActions();
-        }
+    if (!isEnabled() && !isDisabling()) {
+        return;
     }
-    if (isEnabled() || isDisabling()) {
-        // If this force component is enabled then we need to keep trying
-        // to drive this force component to it's target value.
-        // To do this we need to find the vector with the largest delta
-        // and scale all other vectors based off how long it will take to
-        // drive that delta to 0N.
-        float largestDelta = 0.0;
-        for (int i = 0; i < FA_COUNT; ++i) {
-            if (i < FA_X_COUNT) {
-                xOffset[i] = xTarget[i] - xCurrent[i];
-                if (std::abs(xOffset[i]) > largestDelta) {
-                    largestDelta = std::abs(xOffset[i]);
-                }
-            }
 
-            if (i < FA_Y_COUNT) {
-                yOffset[i] = yTarget[i] - yCurrent[i];
-                if (std::abs(yOffset[i]) > largestDelta) {
-                    largestDelta = std::abs(yOffset[i]);
-                }
-            }
+    // Converged component with unchanged target keeps its forces. The first
+    // update after construction, enable or reset always runs postUpdateActions.
+    if (isEnabled() && _published && memcmp(_current, _target, sizeof(_current)) == 0) {
+        postUnchangedActions();
+        return;
+    }
 
-            zOffset[i] = zTarget[i] - zCurrent[i];
-            if (std::abs(zOffset[i]) > largestDelta) {
-                largestDelta = std::abs(zOffset[i]);
-            }
+    // Single sweep over all X, Y and Z forces calculates offsets to target,
+    // the largest delta and checks whether all current forces are near zero.
+    // Lanes keep independent maxima, so the compiler can vectorise the loop.
+    static_assert(FORCE_COUNT % LANES == 0, "Force count must be multiple of lanes");
+    float largestDeltas[LANES] = {0};
+    bool nearZero[LANES];
+    for (int l = 0; l < LANES; ++l) {
+        nearZero[l] = true;
+    }
+    for (int i = 0; i < FORCE_COUNT; i += LANES) {
+        for (int l = 0; l < LANES; ++l) {
+            _offset[i + l] = _target[i + l] - _current[i + l];
+            float delta = std::abs(_offset[i + l]);
+            largestDeltas[l] = delta > largestDeltas[l] ? delta : largestDeltas[l];
+            nearZero[l] = nearZero[l] && std::abs(_current[i + l]) < _nearZeroValue;
         }
-        // Determine how many outer loop cycles it will take to drive the
-        // largest delta to 0N and use that as a scalar for all other
-        // actuator deltas.
-        float scalar = largestDelta / _maxRateOfChange;
-        if (scalar > 1) {
-            // If it is more than 1 outer loop cycle keep working, we aren't
-            // then we need to keep working!
-            for (int i = 0; i < FA_COUNT; ++i) {
-                if (i < FA_X_COUNT) {
-                    xOffset[i] /= scalar;
-                    xCurrent[i] += xOffset[i];
-                }
-
-                if (i < FA_Y_COUNT) {
-                    yOffset[i] /= scalar;
-                    yCurrent[i] += yOffset[i];
-                }
-
-                zOffset[i] /= scalar;
-                zCurrent[i] += zOffset[i];
-            }
-        } else {
-            // If it is less than 1 outer loop cycle just set current as the target
-            // we do this to prevent rounding errors from making it so when we
-            // request 100N we don't put 99.998N and claim that is what we where asked
-            // to produce.
-            for (int i = 0; i < FA_COUNT; ++i) {
-                if (i < FA_X_COUNT) {
-                    xCurrent[i] = xTarget[i];
-                }
+    }
+    float largestDelta = 0.0;
+    bool allNearZero = true;
+    for (int l = 0; l < LANES; ++l) {
+        largestDelta = std::max(largestDelta, largestDeltas[l]);
+        allNearZero = allNearZero && nearZero[l];
+    }
 
-                if (i < FA_Y_COUNT) {
-                    yCurrent[i] = yTarget[i];
-                }
+    if (isDisabling() && allNearZero) {
+        // If we are disabling we need to keep driving this force component to 0N
+        // Once we are near zero we consider our action complete and that the force
+        // component is actually disabled
+        SPDLOG_DEBUG("{}ForceComponent: disabled()", _name);
+        _state = DISABLED;
+        memset(_current, 0, sizeof(_current));
+        postEnableDisableActions();
+        postUpdateActions();
+        _published = true;
+        return;
+    }
 
-                zCurrent[i] = zTarget[i];
-            }
+    // If this force component is enabled then we need to keep trying
+    // to drive this force component to it's target value.
+    // To do this we need to find the vector with the largest delta
+    // and scale all other vectors based off how long it will take to
+    // drive that delta to 0N.
+    // Determine how many outer loop cycles it will take to drive the
+    // largest delta to 0N and use that as a scalar for all other
+    // actuator deltas.
+    float scalar = largestDelta / _maxRateOfChange;
+    if (scalar > 1) {
+        // If it is more than 1 outer loop cycle keep working, we aren't
+        // then we need to keep working!
+        for (int i = 0; i < FORCE_COUNT; ++i) {
+            _offset[i] /= scalar;
+            _current[i] += _offset[i];
         }
-        postUpdateActions();
+    } else {
+        // If it is less than 1 outer loop cycle just set current as the target
+        // we do this to prevent rounding errors from making it so when we
+        // request 100N we don't put 99.998N and claim that is what we where asked
+        // to produce.
+        memcpy(_current, _target, sizeof(_current));
     }
+    postUpdateActions();
+    _published = true;
 }
 
 void ForceComponent::reset() {
     _state = DISABLED;
+    _published = false;
     postEnableDisableActions();
 
-    memset(xCurrent, 0, sizeof(xCurrent));
-    memset(yCurrent, 0, sizeof(yCurrent));
-    memset(zCurrent, 0, sizeof(zCurrent));
-    memset(xTarget, 0, sizeof(xTarget));
-    memset(yTarget, 0, sizeof(yTarget));
-    memset(zTarget, 0, sizeof(zTarget));
-    memset(xOffset, 0, sizeof(xOffset));
-    memset(yOffset, 0, sizeof(yOffset));
-    memset(zOffset, 0, sizeof(zOffset));
+    memset(_current, 0, sizeof(_current));
+    memset(_target, 0, sizeof(_target));
+    memset(_offset, 0, sizeof(_offset));
     postUpdateActions();
 }
 
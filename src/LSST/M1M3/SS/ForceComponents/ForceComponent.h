@@ -96,6 +96,11 @@ public:
      */
     void disable();
 
+    /**
+     * Drives current forces towards target. Enabled component whose current
+     * forces already equal target and were processed by postUpdateActions()
+     * is skipped - postUnchangedActions() is called instead.
+     */
     void update();
 
     void reset();
@@ -117,33 +122,88 @@ protected:
      */
     virtual void postUpdateActions() = 0;
 
+    /**
+     * Called from update when current forces haven't changed, so clipping
+     * and forces and moments calculated in the last postUpdateActions call
+     * are still valid. Components publishing forces as telemetry shall
+     * publish them with updated timestamp.
+     */
+    virtual void postUnchangedActions() {}
+
+    /**
+     * Common part of postUnchangedActions. Re-notifies safety controller
+     * about clipping calculated in the last postUpdateActions call and
+     * republishes applied (and, if clipped, preclipped) forces with new
+     * timestamp.
+     *
+     * @param safetyController safety controller to notify
+     * @param notifyClipping component's clipping notification method
+     * @param clippingRequired clipping calculated in the last postUpdateActions
+     * @param applied applied forces event data
+     * @param preclipped preclipped forces event data
+     * @param logApplied publisher method logging applied forces
+     * @param logPreclipped publisher method logging preclipped forces
+     */
+    template <typename TSafety, typename TPublisher, typename TApplied, typename TPreclipped>
+    void republishUnchanged(TSafety *safetyController, void (TSafety::*notifyClipping)(bool),
+                            bool clippingRequired, TApplied *applied, TPreclipped *preclipped,
+                            void (TPublisher::*logApplied)(), void (TPublisher::*logPreclipped)()) {
+        (safetyController->*notifyClipping)(clippingRequired);
+
+        TPublisher &publisher = TPublisher::get();
+        applied->timestamp = publisher.getTimestamp();
+        if (clippingRequired) {
+            preclipped->timestamp = applied->timestamp;
+            (publisher.*logPreclipped)();
+        }
+        (publisher.*logApplied)();
+    }
+
     /// measured actuator current X force
-    float xCurrent[FA_X_COUNT];
+    float *const xCurrent = _current;
     /// measured actuator current Y force
-    float yCurrent[FA_Y_COUNT];
+    float *const yCurrent = _current + FA_X_COUNT;
     /// measured actuator current Z force
-    float zCurrent[FA_Z_COUNT];
+    float *const zCurrent = _current + FA_X_COUNT + FA_Y_COUNT;
 
     /// target actuator X force
-    float xTarget[FA_X_COUNT];
+    float *const xTarget = _target;
     /// target actuator Y force
-    float yTarget[FA_Y_COUNT];
+    float *const yTarget = _target + FA_X_COUNT;
     /// target actuator Z force
-    float zTarget[FA_Z_COUNT];
+    float *const zTarget = _target + FA_X_COUNT + FA_Y_COUNT;
 
     /// difference (error) between current and target X force
-    float xOffset[FA_X_COUNT];
+    float *const xOffset = _offset;
     /// difference (error) between current and target Y force
-    float yOffset[FA_Y_COUNT];
+    float *const yOffset = _offset + FA_X_COUNT;
     /// difference (error) between current and target Z force
-    float zOffset[FA_Z_COUNT];
+    float *const zOffset = _offset + FA_X_COUNT + FA_Y_COUNT;
 
 private:
+    ForceComponent(const ForceComponent &) = delete;
+    ForceComponent &operator=(const ForceComponent &) = delete;
+
+    /// total number of X, Y and Z forces
+    static constexpr int FORCE_COUNT = FA_X_COUNT + FA_Y_COUNT + FA_Z_COUNT;
+    /// number of independent reductions in update()
+    static constexpr int LANES = 4;
+
+    /**
+     * X, Y and Z forces are stored contiguously, so update() processes all
+     * axes in a single branch-free loop.
+     */
+    float _current[FORCE_COUNT];
+    float _target[FORCE_COUNT];
+    float _offset[FORCE_COUNT];
+
     const char *_name;
     float _maxRateOfChange;
     float _nearZeroValue;
 
     ForceComponentState _state;
+    /// true if postUpdateActions ran with the current forces, cleared on enable and reset
+    bool _published;
 };
 
 } /* namespace SS */
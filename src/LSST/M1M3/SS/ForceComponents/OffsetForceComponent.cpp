@@ -113,9 +113,9 @@ void OffsetForceComponent::applyActuatorOffset(char axis, int index, float offse
 }
 
 void OffsetForceComponent::zeroOffsetForces() {
-    memset(xTarget, 0, sizeof(xTarget));
-    memset(yTarget, 0, sizeof(yTarget));
-    memset(zTarget, 0, sizeof(zTarget));
+    memset(xTarget, 0, sizeof(float) * FA_X_COUNT);
+    memset(yTarget, 0, sizeof(float) * FA_Y_COUNT);
+    memset(zTarget, 0, sizeof(float) * FA_Z_COUNT);
 }
 
 void OffsetForceComponent::postEnableDisableActions() {
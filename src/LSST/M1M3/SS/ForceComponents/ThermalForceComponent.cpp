@@ -48,6 +48,7 @@ ThermalForceComponent::ThermalForceComponent(
     _forceSetpointWarning = M1M3SSPublisher::get().getEventForceSetpointWarning();
     _appliedThermalForces = M1M3SSPublisher::get().getAppliedThermalForces();
     _preclippedThermalForces = M1M3SSPublisher::get().getEventPreclippedThermalForces();
+    _clippingRequired = false;
 }
 
 void ThermalForceComponent::applyThermalForces(float* x, float* y, float* z) {
@@ -171,6 +172,8 @@ void ThermalForceComponent::postUpdateActions() {
 
     _safetyController->forceControllerNotifyThermalForceClipping(clippingRequired);
 
+    _clippingRequired = clippingRequired;
+
     M1M3SSPublisher::get().tryLogForceSetpointWarning();
     if (clippingRequired) {
         M1M3SSPublisher::get().logPreclippedThermalForces();
@@ -178,6 +181,15 @@ void ThermalForceComponent::postUpdateActions() {
     M1M3SSPublisher::get().logAppliedThermalForces();
 }
 
+void ThermalForceComponent::postUnchangedActions() {
+    SPDLOG_TRACE("ThermalForceController: postUnchangedActions()");
+
+    republishUnchanged(_safetyController, &SafetyController::forceControllerNotifyThermalForceClipping,
+                       _clippingRequired, _appliedThermalForces, _preclippedThermalForces,
+                       &M1M3SSPublisher::logAppliedThermalForces,
+                       &M1M3SSPublisher::logPreclippedThermalForces);
+}
+
 }  // namespace SS
 }  // namespace M1M3
 } /* namespace LSST */
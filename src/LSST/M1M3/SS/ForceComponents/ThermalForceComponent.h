@@ -53,6 +53,7 @@ public:
 protected:
     void postEnableDisableActions() override;
     void postUpdateActions() override;
+    void postUnchangedActions() override;
 
 private:
     SafetyController* _safetyController;
@@ -63,6 +64,9 @@ private:
     MTM1M3_logevent_forceSetpointWarningC* _forceSetpointWarning;
     MTM1M3_appliedThermalForcesC* _appliedThermalForces;
     MTM1M3_logevent_preclippedThermalForcesC* _preclippedThermalForces;
+
+    /// clipping result of the last postUpdateActions call
+    bool _clippingRequired;
 };
 
 } /* namespace SS */
@@ -48,6 +48,7 @@ VelocityForceComponent::VelocityForceComponent(
     _forceSetpointWarning = M1M3SSPublisher::get().getEventForceSetpointWarning();
     _appliedVelocityForces = M1M3SSPublisher::get().getAppliedVelocityForces();
     _preclippedVelocityForces = M1M3SSPublisher::get().getEventPreclippedVelocityForces();
+    _clippingRequired = false;
 }
 
 void VelocityForceComponent::applyVelocityForces(float* x, float* y, float* z) {
@@ -175,6 +176,8 @@ void VelocityForceComponent::postUpdateActions() {
 
     _safetyController->forceControllerNotifyVelocityForceClipping(clippingRequired);
 
+    _clippingRequired = clippingRequired;
+
     M1M3SSPublisher::get().tryLogForceSetpointWarning();
     if (clippingRequired) {
         M1M3SSPublisher::get().logPreclippedVelocityForces();
@@ -182,6 +185,15 @@ void VelocityForceComponent::postUpdateActions() {
     M1M3SSPublisher::get().logAppliedVelocityForces();
 }
 
+void VelocityForceComponent::postUnchangedActions() {
+    SPDLOG_TRACE("VelocityForceController: postUnchangedActions()");
+
+    republishUnchanged(_safetyController, &SafetyController::forceControllerNotifyVelocityForceClipping,
+                       _clippingRequired, _appliedVelocityForces, _preclippedVelocityForces,
+                       &M1M3SSPublisher::logAppliedVelocityForces,
+                       &M1M3SSPublisher::logPreclippedVelocityForces);
+}
+
 } /* namespace SS */
 } /* namespace M1M3 */
 } /* namespace LSST */
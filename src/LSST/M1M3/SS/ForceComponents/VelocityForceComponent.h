@@ -46,6 +46,7 @@ public:
 protected:
     void postEnableDisableActions() override;
     void postUpdateActions() override;
+    void postUnchangedActions() override;
 
 private:
     SafetyController* _safetyController;
@@ -56,6 +57,9 @@ private:
     MTM1M3_logevent_forceSetpointWarningC* _forceSetpointWarning;
     MTM1M3_appliedVelocityForcesC* _appliedVelocityForces;
     MTM1M3_logevent_preclippedVelocityForcesC* _preclippedVelocityForces;
+
+    /// clipping result of the last postUpdateActions call
+    bool _clippingRequired;
 };
 
 } /* namespace SS */
@@ -41,9 +41,13 @@
 #include <HardpointActuatorSettings.h>
 #include <RoundRobin.h>
 #include <PositionController.h>
+#include <SettingReader.h>
+#include <ModbusWireTime.h>
 #include <cmath>
 
 #define ADDRESS_COUNT 256
+// outer loop runs at 50 Hz
+#define OUTER_LOOP_PERIOD_US 20000
 
 using namespace LSST::M1M3::SS;
 
@@ -115,6 +119,11 @@ void ILC::buildBusLists() {
     _busListFreezeSensor.buildBuffer();
     _busListRaised.buildBuffer();
     _busListActive.buildBuffer();
+
+    // bus lists executed in every outer loop cycle
+    _logWireTime("FreezeSensor", &_busListFreezeSensor);
+    _logWireTime("Raised", &_busListRaised);
+    _logWireTime("Active", &_busListActive);
 }
 
 void ILC::writeCalibrationDataBuffer() {
@@ -268,6 +277,33 @@ void ILC::readAll() {
     read(5);
 }
 
+void ILC::waitAndReadAll(int32_t timeout) {
+    SPDLOG_DEBUG("ILC: waitAndReadAll({:d})", timeout);
+    if (SettingReader::instance().getOuterLoopApplicationSettings()->StreamedSubnetReadout == false) {
+        waitForAllSubnets(timeout);
+        readAll();
+        return;
+    }
+
+    uint8_t pending = (1 << SUBNET_COUNT) - 1;
+    while (pending != 0) {
+        uint8_t ready = IFPGA::get().waitForAnyModbusIRQ(pending, timeout);
+        if (ready == 0) {
+            // as waitForSubnet, read whatever is available after timeout
+            SPDLOG_WARN("ILC: Timeout waiting for subnets {:#04x} IRQ", pending);
+            ready = pending;
+        }
+        for (int subnet = 1; subnet <= SUBNET_COUNT; subnet++) {
+            uint8_t mask = 1 << (subnet - 1);
+            if (ready & mask) {
+                IFPGA::get().ackModbusIRQ(subnet);
+                read(subnet);
+                pending &= ~mask;
+            }
+        }
+    }
+}
+
 void ILC::flush(uint8_t subnet) {
     SPDLOG_DEBUG("ILC: flush({:d})", (int32_t)subnet);
     uint16_t add = _subnetToRxAddress(subnet);
@@ -438,23 +474,29 @@ void ILC::disableFA(uint32_t actuatorId) {
         return;
     }
     _subnetData.disableFA(actuatorId);
+    _updateDisabledFarNeighbors();
     M1M3SSPublisher::get().getEnabledForceActuators()->setEnabled(actuatorId, false);
     buildBusLists();
 }
 
 void ILC::enableFA(uint32_t actuatorId) {
     _subnetData.enableFA(actuatorId);
+    _updateDisabledFarNeighbors();
     M1M3SSPublisher::get().getEnabledForceActuators()->setEnabled(actuatorId, true);
     buildBusLists();
 }
 
 void ILC::enableAllFA() {
     _subnetData.enableAllFA();
+    _disabledFarNeighbor.reset();
     M1M3SSPublisher::get().getEnabledForceActuators()->setEnabledAll();
     buildBusLists();
 }
 
 uint32_t ILC::hasDisabledFarNeighbor(uint32_t actuatorIndex) {
+    if (actuatorIndex >= FA_COUNT || !_disabledFarNeighbor[actuatorIndex]) {
+        return 0;
+    }
     for (auto farID : _forceActuatorSettings->Neighbors[actuatorIndex].FarIDs) {
         if (isDisabled(farID)) {
             return farID;
@@ -497,6 +539,42 @@ uint8_t ILC::_subnetToTxAddress(uint8_t subnet) {
     }
 }
 
+void ILC::_updateDisabledFarNeighbors() {
+    _disabledFarNeighbor.reset();
+    if (_subnetData.getFADisabled().none()) {
+        return;
+    }
+    for (int zIndex = 0; zIndex < FA_COUNT; zIndex++) {
+        for (auto farID : _forceActuatorSettings->Neighbors[zIndex].FarIDs) {
+            if (_subnetData.isDisabled(farID)) {
+                _disabledFarNeighbor.set(zIndex);
+                break;
+            }
+        }
+    }
+}
+
+void ILC::_logWireTime(const char* name, BusList* busList) {
+    ModbusWireTime wireTime(_ilcMessageFactory.getILCApplicationSettings()->ModbusBaudRate);
+    auto subnets = wireTime.analyze(busList->getBuffer(), busList->getLength());
+    for (auto& s : subnets) {
+        SPDLOG_DEBUG("ILC: {} bus list subnet {}: {} frames, {} bytes, TX {:.0f} us, wait {:.0f} us, "
+                     "total {:.0f} us",
+                     name, s.subnet + 1, s.frames, s.txBytes, s.txTime, s.waitTime, s.total());
+    }
+    auto busiest = ModbusWireTime::busiest(subnets);
+    if (busiest == nullptr) {
+        return;
+    }
+    if (busiest->total() > OUTER_LOOP_PERIOD_US) {
+        SPDLOG_WARN("ILC: {} bus list subnet {} predicted time {:.0f} us exceeds outer loop period {} us",
+                    name, busiest->subnet + 1, busiest->total(), OUTER_LOOP_PERIOD_US);
+    } else {
+        SPDLOG_INFO("ILC: {} bus list predicted time {:.0f} us (subnet {})", name, busiest->total(),
+                    busiest->subnet + 1);
+    }
+}
+
 void ILC::_writeBusList(BusList* busList) {
     IFPGA::get().writeCommandFIFO(busList->getBuffer(), busList->getLength(), 0);
     _responseParser.incExpectedResponses(busList->getExpectedFAResponses(), busList->getExpectedHPResponses(),
@@ -54,6 +54,8 @@
 #include <PositionController.h>
 #include <SafetyController.h>
 
+#include <bitset>
+
 namespace LSST {
 namespace M1M3 {
 namespace SS {
@@ -120,6 +122,17 @@ public:
 
     void read(uint8_t subnet);
     void readAll();
+
+    /**
+     * Waits for all subnets and reads their responses. If
+     * OuterLoopApplicationSettings::StreamedSubnetReadout is set, each subnet
+     * response is read and parsed as soon as its IRQ is raised, in order the
+     * subnets complete. Otherwise equivalent to waitForAllSubnets followed by
+     * readAll.
+     *
+     * @param timeout timeout in microseconds for each IRQ wait
+     */
+    void waitAndReadAll(int32_t timeout);
     void flush(uint8_t subnet);
     void flushAll();
 
@@ -165,7 +178,7 @@ public:
      *
      * @return true when given actuator is disabled, false otherwise
      */
-    bool isDisabled(uint32_t actuatorId) { return _subnetData.getMap(actuatorId).Disabled; }
+    bool isDisabled(uint32_t actuatorId) { return _subnetData.isDisabled(actuatorId); }
 
     /**
      * Check if any far neighbor of an actuator with given index is disabled.
@@ -173,6 +186,9 @@ public:
      * @param actuatorIndex actuator index (0-155) of FA to check
      *
      * @return disabled actuator ID (101..) or 0 when no disabled actuator was found
+     *
+     * @note Checks precomputed bitmask first, so the common case (no far
+     * neighbor disabled) takes constant time.
      */
     uint32_t hasDisabledFarNeighbor(uint32_t actuatorIndex);
 
@@ -216,11 +232,25 @@ private:
 
     int32_t _controlListToggle;
 
+    // bit set for FA (Z index) with any disabled far neighbor
+    std::bitset<FA_COUNT> _disabledFarNeighbor;
+
+    void _updateDisabledFarNeighbors();
+
     uint8_t _subnetToRxAddress(uint8_t subnet);
     uint8_t _subnetToTxAddress(uint8_t subnet);
 
     void _writeBusList(BusList* busList);
 
+    /**
+     * Predicts bus list subnet wire times (see ModbusWireTime). Logs them,
+     * warns if the busiest subnet doesn't fit into outer loop period.
+     *
+     * @param name bus list name, used in log messages
+     * @param busList bus list to analyse
+     */
+    void _logWireTime(const char* name, BusList* busList);
+
     void _updateHPSteps();
 };
 
@@ -0,0 +1,104 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <ILCFrameIndexer.h>
+#include <CRC.h>
+#include <Timestamp.h>
+
+using namespace LSST::M1M3::SS;
+
+// masks for FPGA FIFO response words
+const static uint16_t FIFO_INSTRUCTION = 0xF000;
+const static uint16_t FIFO_RX_ENDFRAME = 0xA000;
+const static uint16_t FIFO_RX_TIMESTAMP = 0xB000;
+
+ILCFrameIndexer::ILCFrameIndexer() {
+    // enough for the longest response buffer, so no allocation happens in index
+    _frames.reserve(512);
+}
+
+size_t ILCFrameIndexer::index(const uint16_t* buffer, int32_t start, int32_t end) {
+    _frames.clear();
+
+    int32_t frameStart = start;
+    int32_t dataLength = 0;
+    uint16_t crc = 0xFFFF;
+    // last two data bytes - either payload, or received CRC at the frame end
+    uint16_t lastBytes = 0;
+    uint64_t rawTimestamp = 0;
+    int timestampShift = 0;
+
+    auto addFrame = [&](int32_t frameEnd) {
+        ILCResponseFrame frame;
+        frame.address = dataLength > 0 ? static_cast<uint8_t>(buffer[frameStart] >> 1) : 0;
+        frame.function = dataLength > 1 ? static_cast<uint8_t>(buffer[frameStart + 1] >> 1) : 0;
+        frame.payloadOffset = frameStart + 2;
+        frame.payloadLength = dataLength >= 4 ? dataLength - 4 : 0;
+        frame.timestamp = Timestamp::fromRaw(rawTimestamp);
+        frame.receivedCRC = (lastBytes >> 8) | (lastBytes << 8);
+        frame.calculatedCRC = crc;
+        frame.crcOk = dataLength >= 4 && frame.receivedCRC == frame.calculatedCRC;
+        _frames.push_back(frame);
+
+        frameStart = frameEnd;
+        dataLength = 0;
+        crc = 0xFFFF;
+        lastBytes = 0;
+        rawTimestamp = 0;
+        timestampShift = 0;
+    };
+
+    for (int32_t i = start; i < end; i++) {
+        uint16_t word = buffer[i];
+        switch (word & FIFO_INSTRUCTION) {
+            case FIFO_RX_ENDFRAME:
+                addFrame(i + 1);
+                break;
+            case FIFO_RX_TIMESTAMP:
+                if (timestampShift < 64) {
+                    rawTimestamp |= static_cast<uint64_t>(word & 0xFF) << timestampShift;
+                    timestampShift += 8;
+                }
+                break;
+            default:
+                // data words after timestamp start aren't expected
+                if (timestampShift > 0) {
+                    break;
+                }
+                if (dataLength >= 2) {
+                    crc = CRC::modbusStep(crc, lastBytes >> 8);
+                }
+                lastBytes = (lastBytes << 8) | static_cast<uint8_t>(word >> 1);
+                dataLength++;
+                break;
+        }
+    }
+
+    // incomplete frame at the buffer end
+    if (frameStart < end) {
+        addFrame(end);
+        _frames.back().crcOk = false;
+    }
+
+    return _frames.size();
+}
@@ -0,0 +1,83 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ILCFRAMEINDEXER_H_
+#define ILCFRAMEINDEXER_H_
+
+#include <DataTypes.h>
+#include <cstddef>
+#include <vector>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Position and properties of a single ILC response frame in subnet response
+ * buffer.
+ */
+struct ILCResponseFrame {
+    uint8_t address;        /// ILC address, 0 if frame is too short
+    uint8_t function;       /// function code, 0 if frame is too short
+    int32_t payloadOffset;  /// buffer index of the first payload (after function code) word
+    int32_t payloadLength;  /// number of payload words, without address, function and CRC
+    double timestamp;       /// frame receive timestamp
+    uint16_t receivedCRC;
+    uint16_t calculatedCRC;
+    bool crcOk;  /// true if frame is long enough and received CRC matches calculated
+};
+
+/**
+ * Indexes ILC response frames in subnet response buffer. Walks the buffer
+ * only once, calculating CRC and decoding timestamp as FIFO words are
+ * processed. Frames can then be parsed without rescanning the buffer.
+ *
+ * Each frame consists of data words (address, function, payload, 2 CRC
+ * bytes), 8 timestamp words and end of frame marker.
+ */
+class ILCFrameIndexer {
+public:
+    ILCFrameIndexer();
+
+    /**
+     * Index frames in the buffer. Previously indexed frames are cleared.
+     *
+     * @param buffer response FIFO words
+     * @param start index of the first frame word
+     * @param end index past the last buffer word
+     *
+     * @return number of frames found
+     */
+    size_t index(const uint16_t* buffer, int32_t start, int32_t end);
+
+    const std::vector<ILCResponseFrame>& getFrames() const { return _frames; }
+
+private:
+    std::vector<ILCResponseFrame> _frames;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* ILCFRAMEINDEXER_H_ */
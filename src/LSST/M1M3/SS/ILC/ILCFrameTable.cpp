@@ -0,0 +1,48 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <ILCFrameTable.h>
+
+#include <cstring>
+#include <stdexcept>
+
+using namespace LSST::M1M3::SS;
+
+ILCFrameTable::ILCFrameTable() { memset(_frames, 0, sizeof(_frames)); }
+
+void ILCFrameTable::build(uint8_t function, uint32_t timeoutMicros) {
+    // encode with ModbusBuffer, so templates match frames written by it
+    ModbusBuffer encoder;
+    for (int address = 0; address < 256; address++) {
+        encoder.reset();
+        encoder.writeU8(address);
+        encoder.writeU8(function);
+        encoder.writeCRC(2);
+        encoder.writeEndOfFrame();
+        encoder.writeWaitForRx(timeoutMicros);
+        if (encoder.getIndex() != FRAME_LENGTH) {
+            throw std::logic_error("ILCFrameTable: unexpected encoded frame length");
+        }
+        memcpy(_frames[address], encoder.getBuffer(), sizeof(_frames[address]));
+    }
+}
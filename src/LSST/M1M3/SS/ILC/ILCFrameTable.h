@@ -0,0 +1,84 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ILCFRAMETABLE_H_
+#define ILCFRAMETABLE_H_
+
+#include <DataTypes.h>
+#include <ModbusBuffer.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Pre-encoded ILC requests consisting of address and function code only
+ * (e.g. ReportServerStatus, PneumaticForceAndStatus). Frame bytes, CRC, end
+ * of frame and wait for response instructions depend only on the ILC
+ * address, so all addresses are encoded once, when ILCMessageFactory is
+ * constructed after settings are loaded. Writing a request is then a copy
+ * of 6 FPGA FIFO instructions.
+ */
+class ILCFrameTable {
+public:
+    /// number of FIFO instructions in the frame - 2 bytes, 2 CRC bytes, end of frame and wait for Rx
+    static constexpr int FRAME_LENGTH = 6;
+
+    ILCFrameTable();
+
+    /**
+     * Encodes frames for all addresses.
+     *
+     * @param function ILC function code
+     * @param timeoutMicros response timeout (microseconds)
+     */
+    void build(uint8_t function, uint32_t timeoutMicros);
+
+    /**
+     * Writes pre-encoded frame to buffer.
+     *
+     * @param buffer buffer to write into
+     * @param address ILC address
+     */
+    void write(ModbusBuffer* buffer, uint8_t address) const {
+        buffer->writeInstructions(_frames[address], FRAME_LENGTH);
+    }
+
+    /**
+     * Returns pre-encoded frame.
+     *
+     * @param address ILC address
+     *
+     * @return FRAME_LENGTH FIFO instructions
+     */
+    const uint16_t* getFrame(uint8_t address) const { return _frames[address]; }
+
+private:
+    uint16_t _frames[256][FRAME_LENGTH];
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* ILCFRAMETABLE_H_ */
@@ -32,22 +32,26 @@ namespace SS {
 
 ILCMessageFactory::ILCMessageFactory(ILCApplicationSettings* ilcApplicationSettings) {
     _ilcApplicationSettings = ilcApplicationSettings;
+    _reportServerIDFrames.build(17, _ilcApplicationSettings->ReportServerID);
+    _reportServerStatusFrames.build(18, _ilcApplicationSettings->ReportServerStatus);
+    _electromechanicalForceAndStatusFrames.build(67,
+                                                 _ilcApplicationSettings->ElectromechanicalForceAndStatus);
+    _readBoostValveDCAGainsFrames.build(74, _ilcApplicationSettings->ReadBoostValveDCAGains);
+    _pneumaticForceStatusFrames.build(76, _ilcApplicationSettings->PneumaticForceAndStatus);
+    _resetFrames.build(107, _ilcApplicationSettings->Reset);
+    _readCalibrationFrames.build(110, _ilcApplicationSettings->ReadCalibration);
+    _reportDCAPressureFrames.build(119, _ilcApplicationSettings->ReportDCAPressure);
+    _reportDCAIDFrames.build(120, _ilcApplicationSettings->ReportDCAID);
+    _reportDCAStatusFrames.build(121, _ilcApplicationSettings->ReportDCAStatus);
+    _reportLVDTFrames.build(122, _ilcApplicationSettings->ReportLVDT);
 }
 
 void ILCMessageFactory::reportServerID(ModbusBuffer* buffer, uint8_t address) {
-    buffer->writeU8(address);
-    buffer->writeU8(17);
-    buffer->writeCRC(2);
-    buffer->writeEndOfFrame();
-    buffer->writeWaitForRx(_ilcApplicationSettings->ReportServerID);
+    _reportServerIDFrames.write(buffer, address);
 }
 
 void ILCMessageFactory::reportServerStatus(ModbusBuffer* buffer, uint8_t address) {
-    buffer->writeU8(address);
-    buffer->writeU8(18);
-    buffer->writeCRC(2);
-    buffer->writeEndOfFrame();
-    buffer->writeWaitForRx(_ilcApplicationSettings->ReportServerStatus);
+    _reportServerStatusFrames.write(buffer, address);
 }
 
 void ILCMessageFactory::changeILCMode(ModbusBuffer* buffer, uint8_t address, uint16_t mode) {
@@ -86,11 +90,7 @@ void ILCMessageFactory::unicastStepMotor(ModbusBuffer* buffer, uint8_t address,
 }
 
 void ILCMessageFactory::electromechanicalForceAndStatus(ModbusBuffer* buffer, uint8_t address) {
-    buffer->writeU8(address);
-    buffer->writeU8(67);
-    buffer->writeCRC(2);
-    buffer->writeEndOfFrame();
-    buffer->writeWaitForRx(_ilcApplicationSettings->ElectromechanicalForceAndStatus);
+    _electromechanicalForceAndStatusFrames.write(buffer, address);
 }
 
 void ILCMessageFactory::broadcastElectromechanicalFreezeSensorValues(ModbusBuffer* buffer,
@@ -124,11 +124,7 @@ void ILCMessageFactory::setBoostValveDCAGains(ModbusBuffer* buffer, uint8_t addr
 }
 
 void ILCMessageFactory::readBoostValveDCAGains(ModbusBuffer* buffer, uint8_t address) {
-    buffer->writeU8(address);
-    buffer->writeU8(74);
-    buffer->writeCRC(2);
-    buffer->writeEndOfFrame();
-    buffer->writeWaitForRx(_ilcApplicationSettings->ReadBoostValveDCAGains);
+    _readBoostValveDCAGainsFrames.write(buffer, address);
 }
 
 void ILCMessageFactory::broadcastForceDemand(ModbusBuffer* buffer, uint8_t broadcastCounter, bool slewFlag,
@@ -150,6 +146,19 @@ void ILCMessageFactory::broadcastForceDemand(ModbusBuffer* buffer, uint8_t broad
     buffer->writeDelay(_ilcApplicationSettings->BroadcastForceDemand);
 }
 
+void ILCMessageFactory::broadcastForceDemand(ModbusBuffer* buffer, uint8_t broadcastCounter, bool slewFlag) {
+    buffer->writeU8(249);
+    buffer->writeU8(75);
+    buffer->writeU8(broadcastCounter);
+    buffer->writeU8(slewFlag ? 255 : 0);
+    for (int i = 0; i < 16 * 3 + 32 * 6; i++) {
+        buffer->writeU8(0);
+    }
+    buffer->writeCRC(244);
+    buffer->writeEndOfFrame();
+    buffer->writeDelay(_ilcApplicationSettings->BroadcastForceDemand);
+}
+
 void ILCMessageFactory::unicastForceDemand(ModbusBuffer* buffer, uint8_t address, bool slewFlag,
                                            int32_t primarySetpoint, int32_t secondarySetpoint = 0) {
     if (address <= 16) {
@@ -183,11 +192,7 @@ void ILCMessageFactory::unicastDualAxisForceDemand(ModbusBuffer* buffer, uint8_t
 }
 
 void ILCMessageFactory::pneumaticForceStatus(ModbusBuffer* buffer, uint8_t address) {
-    buffer->writeU8(address);
-    buffer->writeU8(76);
-    buffer->writeCRC(2);
-    buffer->writeEndOfFrame();
-    buffer->writeWaitForRx(_ilcApplicationSettings->PneumaticForceAndStatus);
+    _pneumaticForceStatusFrames.write(buffer, address);
 }
 
 void ILCMessageFactory::setADCScanRate(ModbusBuffer* buffer, uint8_t address, uint8_t rate) {
@@ -215,52 +220,26 @@ void ILCMessageFactory::setADCChannelOffsetAndSensitivity(ModbusBuffer* buffer,
     buffer->writeWaitForRx(_ilcApplicationSettings->SetADCChannelOffsetAndSensitivity);
 }
 
-void ILCMessageFactory::reset(ModbusBuffer* buffer, uint8_t address) {
-    buffer->writeU8(address);
-    buffer->writeU8(107);
-    buffer->writeCRC(2);
-    buffer->writeEndOfFrame();
-    buffer->writeWaitForRx(_ilcApplicationSettings->Reset);
-}
+void ILCMessageFactory::reset(ModbusBuffer* buffer, uint8_t address) { _resetFrames.write(buffer, address); }
 
 void ILCMessageFactory::readCalibration(ModbusBuffer* buffer, uint8_t address) {
-    buffer->writeU8(address);
-    buffer->writeU8(110);
-    buffer->writeCRC(2);
-    buffer->writeEndOfFrame();
-    buffer->writeWaitForRx(_ilcApplicationSettings->ReadCalibration);
+    _readCalibrationFrames.write(buffer, address);
 }
 
 void ILCMessageFactory::reportDCAPressure(ModbusBuffer* buffer, uint8_t address) {
-    buffer->writeU8(address);
-    buffer->writeU8(119);
-    buffer->writeCRC(2);
-    buffer->writeEndOfFrame();
-    buffer->writeWaitForRx(_ilcApplicationSettings->ReportDCAPressure);
+    _reportDCAPressureFrames.write(buffer, address);
 }
 
 void ILCMessageFactory::reportDCAID(ModbusBuffer* buffer, uint8_t address) {
-    buffer->writeU8(address);
-    buffer->writeU8(120);
-    buffer->writeCRC(2);
-    buffer->writeEndOfFrame();
-    buffer->writeWaitForRx(_ilcApplicationSettings->ReportDCAID);
+    _reportDCAIDFrames.write(buffer, address);
 }
 
 void ILCMessageFactory::reportDCAStatus(ModbusBuffer* buffer, uint8_t address) {
-    buffer->writeU8(address);
-    buffer->writeU8(121);
-    buffer->writeCRC(2);
-    buffer->writeEndOfFrame();
-    buffer->writeWaitForRx(_ilcApplicationSettings->ReportDCAStatus);
+    _reportDCAStatusFrames.write(buffer, address);
 }
 
 void ILCMessageFactory::reportLVDT(ModbusBuffer* buffer, uint8_t address) {
-    buffer->writeU8(address);
-    buffer->writeU8(122);
-    buffer->writeCRC(2);
-    buffer->writeEndOfFrame();
-    buffer->writeWaitForRx(_ilcApplicationSettings->ReportLVDT);
+    _reportLVDTFrames.write(buffer, address);
 }
 
 void ILCMessageFactory::nopReportLVDT(ModbusBuffer* buffer, uint8_t address) {
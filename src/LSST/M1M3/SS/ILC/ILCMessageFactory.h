@@ -26,6 +26,7 @@
 
 #include <DataTypes.h>
 #include <ModbusBuffer.h>
+#include <ILCFrameTable.h>
 
 namespace LSST {
 namespace M1M3 {
@@ -33,10 +34,19 @@ namespace SS {
 
 struct ILCApplicationSettings;
 
+/**
+ * Writes ILC requests into ModbusBuffer. Requests without data bytes
+ * (address and function code only) are pre-encoded for all addresses when
+ * the factory is constructed (see ILCFrameTable), and copied into buffer.
+ * Requests carrying data (force demands, step motor,..) are encoded on
+ * every call.
+ */
 class ILCMessageFactory {
 public:
     ILCMessageFactory(ILCApplicationSettings* ilcApplicationSettings);
 
+    ILCApplicationSettings* getILCApplicationSettings() { return _ilcApplicationSettings; }
+
     void reportServerID(ModbusBuffer* buffer, uint8_t address);
 
     /**
@@ -59,6 +69,16 @@ public:
     void broadcastForceDemand(ModbusBuffer* buffer, uint8_t broadcastCounter, bool slewFlag,
                               int32_t* saaPrimarySetpoint, int32_t* daaPrimarySetpoint,
                               int32_t* daaSecondarySetpoint);
+
+    /**
+     * Writes broadcast force demand (function 75) frame with all setpoints
+     * zero. Serves as template filled by ForceDemandFrame::update.
+     *
+     * @param buffer ModbusBuffer where request will be written
+     * @param broadcastCounter broadcast counter
+     * @param slewFlag slew flag
+     */
+    void broadcastForceDemand(ModbusBuffer* buffer, uint8_t broadcastCounter, bool slewFlag);
     void unicastForceDemand(ModbusBuffer* buffer, uint8_t address, bool slewFlag, int32_t primarySetpoint,
                             int32_t secondarySetpoint);
     void unicastSingleAxisForceDemand(ModbusBuffer* buffer, uint8_t address, bool slewFlag,
@@ -88,6 +108,19 @@ public:
 
 private:
     ILCApplicationSettings* _ilcApplicationSettings;
+
+    // pre-encoded requests with address and function code only
+    ILCFrameTable _reportServerIDFrames;
+    ILCFrameTable _reportServerStatusFrames;
+    ILCFrameTable _electromechanicalForceAndStatusFrames;
+    ILCFrameTable _readBoostValveDCAGainsFrames;
+    ILCFrameTable _pneumaticForceStatusFrames;
+    ILCFrameTable _resetFrames;
+    ILCFrameTable _readCalibrationFrames;
+    ILCFrameTable _reportDCAPressureFrames;
+    ILCFrameTable _reportDCAIDFrames;
+    ILCFrameTable _reportDCAStatusFrames;
+    ILCFrameTable _reportLVDTFrames;
 };
 
 } /* namespace SS */
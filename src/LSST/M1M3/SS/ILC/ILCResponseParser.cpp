@@ -30,12 +30,14 @@
 #include <ForceConverter.h>
 #include <ForceActuatorApplicationSettings.h>
 #include <ILCDataTypes.h>
+#include <ILCFrameIndexer.h>
 #include <SafetyController.h>
 #include <Timestamp.h>
 #include <ILCSubnetData.h>
 #include <SAL_MTM1M3C.h>
 #include <cmath>
 #include <cstring>
+#include <stdexcept>
 #include <spdlog/spdlog.h>
 #include <ccpp_sal_MTM1M3.h>  // Provides access to enumerations
 
@@ -123,33 +125,18 @@ ILCResponseParser::ILCResponseParser(ForceActuatorSettings* forceActuatorSetting
     memset(_hmExpectedResponses, 0, sizeof(_hmExpectedResponses));
 }
 
-bool validateCRC(ModbusBuffer* buffer, uint16_t* length, double* timestamp, uint16_t& receivedCRC,
-                 uint16_t& calculatedCRC) {
-    int32_t addressIndex = buffer->getIndex();
-    while (!buffer->endOfFrame() && !buffer->endOfBuffer() && (buffer->readLength() & 0xF000) != 0xB000) {
-    }
-    int32_t crcIndex = buffer->getIndex() - 3;
-    buffer->setIndex(crcIndex);
-    calculatedCRC = buffer->calculateCRC(crcIndex - addressIndex);
-    receivedCRC = buffer->readCRC();
-    (*timestamp) = buffer->readTimestamp();
-    if (receivedCRC == calculatedCRC) {
-        (*length) = crcIndex - addressIndex;
-        buffer->setIndex(addressIndex);
-        return true;
-    } else {
-        buffer->readEndOfFrame();
-        (*length) = buffer->getIndex() - addressIndex;
-        return false;
-    }
-}
-
 void ILCResponseParser::parse(ModbusBuffer* buffer, uint8_t subnet) {
     uint64_t a = buffer->readLength();
     uint64_t b = buffer->readLength();
     uint64_t c = buffer->readLength();
     uint64_t d = buffer->readLength();
     double globalTimestamp = Timestamp::fromRaw((d << 48) | (c << 32) | (b << 16) | a);
+    if (subnet < 1 || subnet > SUBNET_COUNT) {
+        SPDLOG_WARN("ILCResponseParser: Unknown subnet {:d}", subnet);
+        _warnUnknownSubnet(globalTimestamp);
+        buffer->setIndex(buffer->getLength());
+        return;
+    }
     _forceActuatorState->timestamp = globalTimestamp;
     M1M3SSPublisher::getForceActuatorWarning()->setTimestamp(globalTimestamp);
     _forceWarning->timestamp = globalTimestamp;
@@ -160,202 +147,204 @@ void ILCResponseParser::parse(ModbusBuffer* buffer, uint8_t subnet) {
     _hardpointMonitorState->timestamp = globalTimestamp;
     _hardpointMonitorWarning->timestamp = globalTimestamp;
     _hardpointMonitorData->timestamp = globalTimestamp;
-    while (!buffer->endOfBuffer()) {
-        uint16_t length = 0;
-        double timestamp = 0;
-        uint16_t calculatedCRC;
-        uint16_t receivedCRC;
-        if (validateCRC(buffer, &length, &timestamp, calculatedCRC, receivedCRC) == false) {
-            auto data = buffer->getReadData(length);
+    _frameIndexer.index(buffer->getBuffer(), buffer->getIndex(), buffer->getLength());
+    for (auto& response : _frameIndexer.getFrames()) {
+        if (response.crcOk == false) {
             TG_LOG_WARN(60s,
                         "ILCResponseParser: Invalid CRC on subnet {:d} - received {:04X}, calculated {:04X}, "
-                        "address {:02X}, function {:02X}, {:02X}",
-                        subnet, receivedCRC, calculatedCRC, data[0], data[1], data[2]);
-            _warnInvalidCRC(timestamp);
-        } else {
-            if (subnet >= 1 && subnet <= 5) {
-                uint8_t address = buffer->readU8();
-                uint8_t function = buffer->readU8();
-                ILCMap map = _subnetData->getILCDataFromAddress(subnet - 1, address);
-                int32_t dataIndex = map.DataIndex;
-                switch (map.Type) {
-                    case ILCTypes::FA:
-                        _faExpectedResponses[dataIndex]--;
-                        switch (function) {
-                            case 17:
-                                _parseReportFAServerIDResponse(buffer, map);
-                                break;
-                            case 18:
-                                _parseReportFAServerStatusResponse(buffer, map);
-                                break;
-                            case 65:
-                                _parseChangeFAILCModeResponse(buffer, map);
-                                break;
-                            case 73:
-                                _parseSetBoostValveDCAGainsResponse(buffer, map);
-                                break;
-                            case 74:
-                                _parseReadBoostValveDCAGainsResponse(buffer, map);
-                                break;
-                            case 75:
-                                _parseForceDemandResponse(buffer, address, map);
-                                break;
-                            case 76:
-                                _parsePneumaticForceStatusResponse(buffer, address, map);
-                                break;
-                            case 80:
-                                _parseSetFAADCScanRateResponse(buffer, map);
-                                break;
-                            case 81:
-                                _parseSetFAADCChannelOffsetAndSensitivityResponse(buffer, map);
-                                break;
-                            case 107:
-                                _parseFAResetResponse(buffer, map);
-                                break;
-                            case 110:
-                                _parseReadFACalibrationResponse(buffer, map);
-                                break;
-                            case 119:
-                                _parseReadDCAPressureValuesResponse(buffer, map);
-                                break;
-                            case 120:
-                                _parseReportDCAIDResponse(buffer, map);
-                                break;
-                            case 121:
-                                _parseReportDCAStatusResponse(buffer, map);
-                                break;
-                            case 145:
-                            case 146:
-                            case 193:
-                            case 201:
-                            case 202:
-                            case 203:
-                            case 204:
-                            case 208:
-                            case 209:
-                            case 235:
-                            case 238:
-                            case 247:
-                            case 248:
-                            case 249:
-                                _parseErrorResponse(buffer, timestamp, map.ActuatorId);
-                                break;
-                            default:
-                                SPDLOG_WARN(
-                                        "ILCResponseParser: Unknown FA function on subnet {:d} function "
-                                        "{:d}",
-                                        (int)function, subnet);
-                                _warnUnknownFunction(timestamp, map.ActuatorId);
-                                break;
-                        }
-                        break;
-                    case ILCTypes::HP:
-                        _hpExpectedResponses[dataIndex]--;
-                        switch (function) {
-                            case 17:
-                                _parseReportHPServerIDResponse(buffer, map);
-                                break;
-                            case 18:
-                                _parseReportHPServerStatusResponse(buffer, map);
-                                break;
-                            case 65:
-                                _parseChangeHPILCModeResponse(buffer, map);
-                                break;
-                            case 66:
-                            case 67:
-                                _parseElectromechanicalForceAndStatusResponse(buffer, map, timestamp);
-                                break;
-                            case 80:
-                                _parseSetHPADCScanRateResponse(buffer, map);
-                                break;
-                            case 81:
-                                _parseSetHPADCChannelOffsetAndSensitivityResponse(buffer, map);
-                                break;
-                            case 107:
-                                _parseHPResetResponse(buffer, map);
-                                break;
-                            case 110:
-                                _parseReadHPCalibrationResponse(buffer, map);
-                                break;
-                            case 145:
-                            case 146:
-                            case 193:
-                            case 194:
-                            case 195:
-                            case 208:
-                            case 209:
-                            case 235:
-                            case 238:
-                                _parseErrorResponse(buffer, timestamp, map.ActuatorId);
-                                break;
-                            default:
-                                SPDLOG_WARN("ILCResponseParser: Unknown HP function {:d} on subnet {:d}",
-                                            (int)function, subnet);
-                                _warnUnknownFunction(timestamp, map.ActuatorId);
-                                break;
-                        }
-                        break;
-                    case ILCTypes::HM:
-                        _hmExpectedResponses[dataIndex]--;
-                        switch (function) {
-                            case 17:
-                                _parseReportHMServerIDResponse(buffer, map);
-                                break;
-                            case 18:
-                                _parseReportHMServerStatusResponse(buffer, map);
-                                break;
-                            case 65:
-                                _parseChangeHMILCModeResponse(buffer, map);
-                                break;
-                            case 107:
-                                _parseHMResetResponse(buffer, map);
-                                break;
-                            case 119:
-                                _parseReadHMPressureValuesResponse(buffer, map);
-                                break;
-                            case 120:
-                                _parseReportHMMezzanineIDResponse(buffer, map);
-                                break;
-                            case 121:
-                                _parseReportHMMezzanineStatusResponse(buffer, map);
-                                break;
-                            case 122:
-                                _parseReportLVDTResponse(buffer, map);
-                                break;
-                            case 145:
-                            case 146:
-                            case 193:
-                            case 235:
-                            case 247:
-                            case 248:
-                            case 249:
-                            case 250:
-                                _parseErrorResponse(buffer, timestamp, map.ActuatorId);
-                                break;
-                            default:
-                                SPDLOG_WARN("ILCResponseParser: Unknown HM function {:d} on subnet {:d}",
-                                            (int)function, subnet);
-                                _warnUnknownFunction(timestamp, map.ActuatorId);
-                                break;
-                        }
-                        break;
-                    default:
-                        SPDLOG_WARN(
-                                "ILCResponseParser: Unknown address {:d} on subnet {:d} for function "
-                                "code {:d}",
-                                (int)address, (int)subnet, (int)function);
-                        _warnUnknownAddress(timestamp, map.ActuatorId);
-                        break;
-                }
-            } else {
-                SPDLOG_WARN("ILCResponseParser: Unknown subnet {:d}", subnet);
-                _warnUnknownSubnet(timestamp);
-            }
+                        "address {:02X}, function {:02X}",
+                        subnet, response.receivedCRC, response.calculatedCRC, response.address,
+                        response.function);
+            _warnInvalidCRC(response.timestamp);
+            continue;
+        }
+        ModbusView frame(buffer->getBuffer() + response.payloadOffset, response.payloadLength);
+        try {
+            _parseFrame(response, frame, subnet);
+        } catch (std::out_of_range& ex) {
+            TG_LOG_WARN(60s, "ILCResponseParser: Invalid response length on subnet {:d}: {}", subnet,
+                        ex.what());
+            _warnInvalidLength(response.timestamp,
+                               _subnetData->getILCDataFromAddress(subnet - 1, response.address).ActuatorId);
         }
     }
+    buffer->setIndex(buffer->getLength());
     M1M3SSPublisher::getForceActuatorWarning()->log();
 }
 
+void ILCResponseParser::_parseFrame(const ILCResponseFrame& response, ModbusView& frame, uint8_t subnet) {
+    double timestamp = response.timestamp;
+    uint8_t address = response.address;
+    uint8_t function = response.function;
+    const ILCMap& map = _subnetData->getILCDataFromAddress(subnet - 1, address);
+    int32_t dataIndex = map.DataIndex;
+    switch (map.Type) {
+        case ILCTypes::FA:
+            _faExpectedResponses[dataIndex]--;
+            switch (function) {
+                case 17:
+                    _parseReportFAServerIDResponse(frame, map);
+                    break;
+                case 18:
+                    _parseReportFAServerStatusResponse(frame, map);
+                    break;
+                case 65:
+                    _parseChangeFAILCModeResponse(frame, map);
+                    break;
+                case 73:
+                    _parseSetBoostValveDCAGainsResponse(frame, map);
+                    break;
+                case 74:
+                    _parseReadBoostValveDCAGainsResponse(frame, map);
+                    break;
+                case 75:
+                    _parseForceDemandResponse(frame, address, map);
+                    break;
+                case 76:
+                    _parsePneumaticForceStatusResponse(frame, address, map);
+                    break;
+                case 80:
+                    _parseSetFAADCScanRateResponse(frame, map);
+                    break;
+                case 81:
+                    _parseSetFAADCChannelOffsetAndSensitivityResponse(frame, map);
+                    break;
+                case 107:
+                    _parseFAResetResponse(frame, map);
+                    break;
+                case 110:
+                    _parseReadFACalibrationResponse(frame, map);
+                    break;
+                case 119:
+                    _parseReadDCAPressureValuesResponse(frame, map);
+                    break;
+                case 120:
+                    _parseReportDCAIDResponse(frame, map);
+                    break;
+                case 121:
+                    _parseReportDCAStatusResponse(frame, map);
+                    break;
+                case 145:
+                case 146:
+                case 193:
+                case 201:
+                case 202:
+                case 203:
+                case 204:
+                case 208:
+                case 209:
+                case 235:
+                case 238:
+                case 247:
+                case 248:
+                case 249:
+                    _parseErrorResponse(frame, timestamp, map.ActuatorId);
+                    break;
+                default:
+                    SPDLOG_WARN("ILCResponseParser: Unknown FA function on subnet {:d} function {:d}",
+                                (int)function, subnet);
+                    _warnUnknownFunction(timestamp, map.ActuatorId);
+                    break;
+            }
+            break;
+        case ILCTypes::HP:
+            _hpExpectedResponses[dataIndex]--;
+            switch (function) {
+                case 17:
+                    _parseReportHPServerIDResponse(frame, map);
+                    break;
+                case 18:
+                    _parseReportHPServerStatusResponse(frame, map);
+                    break;
+                case 65:
+                    _parseChangeHPILCModeResponse(frame, map);
+                    break;
+                case 66:
+                case 67:
+                    _parseElectromechanicalForceAndStatusResponse(frame, map, timestamp);
+                    break;
+                case 80:
+                    _parseSetHPADCScanRateResponse(frame, map);
+                    break;
+                case 81:
+                    _parseSetHPADCChannelOffsetAndSensitivityResponse(frame, map);
+                    break;
+                case 107:
+                    _parseHPResetResponse(frame, map);
+                    break;
+                case 110:
+                    _parseReadHPCalibrationResponse(frame, map);
+                    break;
+                case 145:
+                case 146:
+                case 193:
+                case 194:
+                case 195:
+                case 208:
+                case 209:
+                case 235:
+                case 238:
+                    _parseErrorResponse(frame, timestamp, map.ActuatorId);
+                    break;
+                default:
+                    SPDLOG_WARN("ILCResponseParser: Unknown HP function {:d} on subnet {:d}",
+                                (int)function, subnet);
+                    _warnUnknownFunction(timestamp, map.ActuatorId);
+                    break;
+            }
+            break;
+        case ILCTypes::HM:
+            _hmExpectedResponses[dataIndex]--;
+            switch (function) {
+                case 17:
+                    _parseReportHMServerIDResponse(frame, map);
+                    break;
+                case 18:
+                    _parseReportHMServerStatusResponse(frame, map);
+                    break;
+                case 65:
+                    _parseChangeHMILCModeResponse(frame, map);
+                    break;
+                case 107:
+                    _parseHMResetResponse(frame, map);
+                    break;
+                case 119:
+                    _parseReadHMPressureValuesResponse(frame, map);
+                    break;
+                case 120:
+                    _parseReportHMMezzanineIDResponse(frame, map);
+                    break;
+                case 121:
+                    _parseReportHMMezzanineStatusResponse(frame, map);
+                    break;
+                case 122:
+                    _parseReportLVDTResponse(frame, map);
+                    break;
+                case 145:
+                case 146:
+                case 193:
+                case 235:
+                case 247:
+                case 248:
+                case 249:
+                case 250:
+                    _parseErrorResponse(frame, timestamp, map.ActuatorId);
+                    break;
+                default:
+                    SPDLOG_WARN("ILCResponseParser: Unknown HM function {:d} on subnet {:d}",
+                                (int)function, subnet);
+                    _warnUnknownFunction(timestamp, map.ActuatorId);
+                    break;
+            }
+            break;
+        default:
+            SPDLOG_WARN("ILCResponseParser: Unknown address {:d} on subnet {:d} for function code {:d}",
+                        (int)address, (int)subnet, (int)function);
+            _warnUnknownAddress(timestamp, map.ActuatorId);
+            break;
+    }
+}
+
 void ILCResponseParser::incExpectedResponses(int32_t* fa, int32_t* hp, int32_t* hm) {
     for (int i = 0; i < FA_COUNT; i++) {
         _faExpectedResponses[i] += fa[i];
@@ -423,8 +412,8 @@ void ILCResponseParser::verifyResponses() {
     _safetyController->ilcCommunicationTimeout(anyTimeout);
 }
 
-void ILCResponseParser::_parseErrorResponse(ModbusBuffer* buffer, double timestamp, int32_t actuatorId) {
-    uint8_t exceptionCode = buffer->readU8();
+void ILCResponseParser::_parseErrorResponse(ModbusView& frame, double timestamp, int32_t actuatorId) {
+    uint8_t exceptionCode = frame.readU8();
     switch (exceptionCode) {
         case 1:
             _warnIllegalFunction(timestamp, actuatorId);
@@ -446,55 +435,51 @@ void ILCResponseParser::_parseErrorResponse(ModbusBuffer* buffer, double timesta
             _warnUnknownProblem(timestamp, actuatorId);
             break;
     }
-    buffer->skipToNextFrame();
 }
 
-void ILCResponseParser::_parseReportHPServerIDResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReportHPServerIDResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    uint8_t length = buffer->readU8();
-    _hardpointActuatorInfo->ilcUniqueId[dataIndex] = buffer->readU48();
-    _hardpointActuatorInfo->ilcApplicationType[dataIndex] = buffer->readU8();
-    _hardpointActuatorInfo->networkNodeType[dataIndex] = buffer->readU8();
-    _hardpointActuatorInfo->ilcSelectedOptions[dataIndex] = buffer->readU8();
-    _hardpointActuatorInfo->networkNodeOptions[dataIndex] = buffer->readU8();
-    _hardpointActuatorInfo->majorRevision[dataIndex] = buffer->readU8();
-    _hardpointActuatorInfo->minorRevision[dataIndex] = buffer->readU8();
-    buffer->incIndex(length - 12);
-    buffer->skipToNextFrame();
+    uint8_t length = frame.readU8();
+    _hardpointActuatorInfo->ilcUniqueId[dataIndex] = frame.readU48();
+    _hardpointActuatorInfo->ilcApplicationType[dataIndex] = frame.readU8();
+    _hardpointActuatorInfo->networkNodeType[dataIndex] = frame.readU8();
+    _hardpointActuatorInfo->ilcSelectedOptions[dataIndex] = frame.readU8();
+    _hardpointActuatorInfo->networkNodeOptions[dataIndex] = frame.readU8();
+    _hardpointActuatorInfo->majorRevision[dataIndex] = frame.readU8();
+    _hardpointActuatorInfo->minorRevision[dataIndex] = frame.readU8();
+    frame.skip(length - 12);
 }
 
-void ILCResponseParser::_parseReportFAServerIDResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReportFAServerIDResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    uint8_t length = buffer->readU8();
-    _forceActuatorInfo->ilcUniqueId[dataIndex] = buffer->readU48();
-    _forceActuatorInfo->ilcApplicationType[dataIndex] = buffer->readU8();
-    _forceActuatorInfo->networkNodeType[dataIndex] = buffer->readU8();
-    _forceActuatorInfo->ilcSelectedOptions[dataIndex] = buffer->readU8();
-    _forceActuatorInfo->networkNodeOptions[dataIndex] = buffer->readU8();
-    _forceActuatorInfo->majorRevision[dataIndex] = buffer->readU8();
-    _forceActuatorInfo->minorRevision[dataIndex] = buffer->readU8();
-    buffer->incIndex(length - 12);
-    buffer->skipToNextFrame();
+    uint8_t length = frame.readU8();
+    _forceActuatorInfo->ilcUniqueId[dataIndex] = frame.readU48();
+    _forceActuatorInfo->ilcApplicationType[dataIndex] = frame.readU8();
+    _forceActuatorInfo->networkNodeType[dataIndex] = frame.readU8();
+    _forceActuatorInfo->ilcSelectedOptions[dataIndex] = frame.readU8();
+    _forceActuatorInfo->networkNodeOptions[dataIndex] = frame.readU8();
+    _forceActuatorInfo->majorRevision[dataIndex] = frame.readU8();
+    _forceActuatorInfo->minorRevision[dataIndex] = frame.readU8();
+    frame.skip(length - 12);
 }
 
-void ILCResponseParser::_parseReportHMServerIDResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReportHMServerIDResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    uint8_t length = buffer->readU8();
-    _hardpointMonitorInfo->ilcUniqueId[dataIndex] = buffer->readU48();
-    _hardpointMonitorInfo->ilcApplicationType[dataIndex] = buffer->readU8();
-    _hardpointMonitorInfo->networkNodeType[dataIndex] = buffer->readU8();
-    buffer->readU8();  // ILCSelectedOptions
-    buffer->readU8();  // NetworkNodeOptions
-    _hardpointMonitorInfo->majorRevision[dataIndex] = buffer->readU8();
-    _hardpointMonitorInfo->minorRevision[dataIndex] = buffer->readU8();
-    buffer->incIndex(length - 12);
-    buffer->skipToNextFrame();
+    uint8_t length = frame.readU8();
+    _hardpointMonitorInfo->ilcUniqueId[dataIndex] = frame.readU48();
+    _hardpointMonitorInfo->ilcApplicationType[dataIndex] = frame.readU8();
+    _hardpointMonitorInfo->networkNodeType[dataIndex] = frame.readU8();
+    frame.readU8();  // ILCSelectedOptions
+    frame.readU8();  // NetworkNodeOptions
+    _hardpointMonitorInfo->majorRevision[dataIndex] = frame.readU8();
+    _hardpointMonitorInfo->minorRevision[dataIndex] = frame.readU8();
+    frame.skip(length - 12);
 }
 
-void ILCResponseParser::_parseReportHPServerStatusResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReportHPServerStatusResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _hardpointActuatorState->ilcState[dataIndex] = buffer->readU8();
-    uint16_t ilcStatus = buffer->readU16();
+    _hardpointActuatorState->ilcState[dataIndex] = frame.readU8();
+    uint16_t ilcStatus = frame.readU16();
     _hardpointActuatorWarning->majorFault[dataIndex] = (ilcStatus & 0x0001) != 0;
     _hardpointActuatorWarning->minorFault[dataIndex] = (ilcStatus & 0x0002) != 0;
     // 0x0004 is reserved
@@ -511,7 +496,7 @@ void ILCResponseParser::_parseReportHPServerStatusResponse(ModbusBuffer* buffer,
     // 0x2000 is DCA (FA only)
     // 0x4000 is DCA (FA only)
     // 0x8000 is reserved
-    uint16_t ilcFaults = buffer->readU16();
+    uint16_t ilcFaults = frame.readU16();
     _hardpointActuatorWarning->uniqueIdCRCError[dataIndex] = (ilcFaults & 0x0001) != 0;
     _hardpointActuatorWarning->applicationTypeMismatch[dataIndex] = (ilcFaults & 0x0002) != 0;
     _hardpointActuatorWarning->applicationMissing[dataIndex] = (ilcFaults & 0x0004) != 0;
@@ -528,20 +513,18 @@ void ILCResponseParser::_parseReportHPServerStatusResponse(ModbusBuffer* buffer,
     _hardpointActuatorWarning->auxPowerFault[dataIndex] = (ilcFaults & 0x2000) != 0;
     _hardpointActuatorWarning->smcPowerFault[dataIndex] = (ilcFaults & 0x4000) != 0;
     // 0x8000 is reserved
-    buffer->skipToNextFrame();
 }
 
-void ILCResponseParser::_parseReportFAServerStatusResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReportFAServerStatusResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _forceActuatorState->ilcState[dataIndex] = buffer->readU8();
-    M1M3SSPublisher::getForceActuatorWarning()->parseFAServerStatusResponse(buffer, dataIndex);
-    buffer->skipToNextFrame();
+    _forceActuatorState->ilcState[dataIndex] = frame.readU8();
+    M1M3SSPublisher::getForceActuatorWarning()->parseFAServerStatusResponse(frame, dataIndex);
 }
 
-void ILCResponseParser::_parseReportHMServerStatusResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReportHMServerStatusResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _hardpointMonitorState->ilcState[dataIndex] = buffer->readU8();
-    uint16_t ilcStatus = buffer->readU16();
+    _hardpointMonitorState->ilcState[dataIndex] = frame.readU8();
+    uint16_t ilcStatus = frame.readU16();
     _hardpointMonitorWarning->majorFault[dataIndex] = (ilcStatus & 0x0001) != 0;
     _hardpointMonitorWarning->minorFault[dataIndex] = (ilcStatus & 0x0002) != 0;
     // 0x0004 is reserved
@@ -558,7 +541,7 @@ void ILCResponseParser::_parseReportHMServerStatusResponse(ModbusBuffer* buffer,
     // 0x2000 is DCA fault (FA only)
     // 0x4000 is DCA firmware update (FA only)
     // 0x8000 is reserved
-    uint16_t ilcFaults = buffer->readU16();
+    uint16_t ilcFaults = frame.readU16();
     _hardpointMonitorWarning->uniqueIdCRCError[dataIndex] = (ilcFaults & 0x0001) != 0;
     _hardpointMonitorWarning->applicationTypeMismatch[dataIndex] = (ilcFaults & 0x0002) != 0;
     _hardpointMonitorWarning->applicationMissing[dataIndex] = (ilcFaults & 0x0004) != 0;
@@ -575,34 +558,30 @@ void ILCResponseParser::_parseReportHMServerStatusResponse(ModbusBuffer* buffer,
     _hardpointMonitorWarning->auxPowerFault[dataIndex] = (ilcFaults & 0x2000) != 0;
     // 0x4000 is SMC Power (HP only)
     // 0x8000 is reserved
-    buffer->skipToNextFrame();
 }
 
-void ILCResponseParser::_parseChangeHPILCModeResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseChangeHPILCModeResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _hardpointActuatorState->ilcState[dataIndex] = buffer->readU16();
-    // buffer->readU8();
-    buffer->skipToNextFrame();
+    _hardpointActuatorState->ilcState[dataIndex] = frame.readU16();
+    // frame.readU8();
 }
 
-void ILCResponseParser::_parseChangeFAILCModeResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseChangeFAILCModeResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _forceActuatorState->ilcState[dataIndex] = buffer->readU16();
-    // buffer->readU8();
-    buffer->skipToNextFrame();
+    _forceActuatorState->ilcState[dataIndex] = frame.readU16();
+    // frame.readU8();
 }
 
-void ILCResponseParser::_parseChangeHMILCModeResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseChangeHMILCModeResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _hardpointMonitorState->ilcState[dataIndex] = buffer->readU16();
-    // buffer->readU8();
-    buffer->skipToNextFrame();
+    _hardpointMonitorState->ilcState[dataIndex] = frame.readU16();
+    // frame.readU8();
 }
 
-void ILCResponseParser::_parseElectromechanicalForceAndStatusResponse(ModbusBuffer* buffer, ILCMap map,
+void ILCResponseParser::_parseElectromechanicalForceAndStatusResponse(ModbusView& frame, const ILCMap& map,
                                                                       double timestamp) {
     int32_t dataIndex = map.DataIndex;
-    uint8_t status = buffer->readU8();
+    uint8_t status = frame.readU8();
     _hardpointActuatorData->timestamp = timestamp;
     _hardpointActuatorWarning->timestamp = timestamp;
     _hardpointActuatorWarning->ilcFault[dataIndex] = (status & 0x01) != 0;
@@ -614,60 +593,55 @@ void ILCResponseParser::_parseElectromechanicalForceAndStatusResponse(ModbusBuff
     // Encoder value needs to be swapped to keep with the theme of extension is positive
     // retaction is negative
     _hardpointActuatorData->encoder[dataIndex] =
-            -buffer->readI32() + _hardpointActuatorSettings->getEncoderOffset(dataIndex);
+            -frame.readI32() + _hardpointActuatorSettings->getEncoderOffset(dataIndex);
     // Unlike the pneumatic, the electromechanical doesn't reverse compression and tension so we swap it here
-    _hardpointActuatorData->measuredForce[dataIndex] = -buffer->readSGL();
+    _hardpointActuatorData->measuredForce[dataIndex] = -frame.readSGL();
     _hardpointActuatorData->displacement[dataIndex] =
             (_hardpointActuatorData->encoder[dataIndex] * _hardpointActuatorSettings->micrometersPerEncoder) /
             (MICROMETERS_PER_MILLIMETER * MILLIMETERS_PER_METER);
-    buffer->skipToNextFrame();
     _checkHardpointActuatorMeasuredForce(dataIndex);
 }
 
-void ILCResponseParser::_parseSetBoostValveDCAGainsResponse(ModbusBuffer* buffer, ILCMap map) {
-    buffer->skipToNextFrame();
-}
+void ILCResponseParser::_parseSetBoostValveDCAGainsResponse(ModbusView& frame, const ILCMap& map) {}
 
-void ILCResponseParser::_parseReadBoostValveDCAGainsResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReadBoostValveDCAGainsResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _forceActuatorInfo->mezzaninePrimaryCylinderGain[dataIndex] = buffer->readSGL();
-    _forceActuatorInfo->mezzanineSecondaryCylinderGain[dataIndex] = buffer->readSGL();
-    buffer->skipToNextFrame();
+    _forceActuatorInfo->mezzaninePrimaryCylinderGain[dataIndex] = frame.readSGL();
+    _forceActuatorInfo->mezzanineSecondaryCylinderGain[dataIndex] = frame.readSGL();
 }
 
-void ILCResponseParser::_parseForceDemandResponse(ModbusBuffer* buffer, uint8_t address, ILCMap map) {
+void ILCResponseParser::_parseForceDemandResponse(ModbusView& frame, uint8_t address, const ILCMap& map) {
     if (address <= 16) {
-        _parseSingleAxisForceDemandResponse(buffer, map);
+        _parseSingleAxisForceDemandResponse(frame, map);
     } else {
-        _parseDualAxisForceDemandResponse(buffer, map);
+        _parseDualAxisForceDemandResponse(frame, map);
     }
     _checkForceActuatorMeasuredForce(map);
     _checkForceActuatorFollowingError(map);
 }
 
-void ILCResponseParser::_parseSingleAxisForceDemandResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseSingleAxisForceDemandResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    M1M3SSPublisher::getForceActuatorWarning()->parseStatus(buffer, dataIndex,
+    M1M3SSPublisher::getForceActuatorWarning()->parseStatus(frame, dataIndex,
                                                             _outerLoopData->broadcastCounter);
-    _forceActuatorData->primaryCylinderForce[dataIndex] = buffer->readSGL();
+    _forceActuatorData->primaryCylinderForce[dataIndex] = frame.readSGL();
     float x = 0;
     float y = 0;
     float z = 0;
     ForceConverter::saaToMirror(_forceActuatorData->primaryCylinderForce[dataIndex],
                                 _forceActuatorData->secondaryCylinderForce[dataIndex], &x, &y, &z);
     _forceActuatorData->zForce[dataIndex] = z;
-    buffer->skipToNextFrame();
 }
 
-void ILCResponseParser::_parseDualAxisForceDemandResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseDualAxisForceDemandResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
     int32_t secondaryDataIndex = map.SecondaryDataIndex;
     int xIndex = map.XDataIndex;
     int yIndex = map.YDataIndex;
-    M1M3SSPublisher::getForceActuatorWarning()->parseStatus(buffer, dataIndex,
+    M1M3SSPublisher::getForceActuatorWarning()->parseStatus(frame, dataIndex,
                                                             _outerLoopData->broadcastCounter);
-    _forceActuatorData->primaryCylinderForce[dataIndex] = buffer->readSGL();
-    _forceActuatorData->secondaryCylinderForce[secondaryDataIndex] = buffer->readSGL();
+    _forceActuatorData->primaryCylinderForce[dataIndex] = frame.readSGL();
+    _forceActuatorData->secondaryCylinderForce[secondaryDataIndex] = frame.readSGL();
     float x = 0;
     float y = 0;
     float z = 0;
@@ -700,43 +674,41 @@ void ILCResponseParser::_parseDualAxisForceDemandResponse(ModbusBuffer* buffer,
         _forceActuatorData->yForce[yIndex] = y;
     }
     _forceActuatorData->zForce[dataIndex] = z;
-    buffer->skipToNextFrame();
 }
 
-void ILCResponseParser::_parsePneumaticForceStatusResponse(ModbusBuffer* buffer, uint8_t address,
-                                                           ILCMap map) {
+void ILCResponseParser::_parsePneumaticForceStatusResponse(ModbusView& frame, uint8_t address,
+                                                           const ILCMap& map) {
     if (address <= 16) {
-        _parseSingleAxisPneumaticForceStatusResponse(buffer, map);
+        _parseSingleAxisPneumaticForceStatusResponse(frame, map);
     } else {
-        _parseDualAxisPneumaticForceStatusResponse(buffer, map);
+        _parseDualAxisPneumaticForceStatusResponse(frame, map);
     }
     _checkForceActuatorMeasuredForce(map);
     _checkForceActuatorFollowingError(map);
 }
 
-void ILCResponseParser::_parseSingleAxisPneumaticForceStatusResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseSingleAxisPneumaticForceStatusResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    M1M3SSPublisher::getForceActuatorWarning()->parseStatus(buffer, dataIndex,
+    M1M3SSPublisher::getForceActuatorWarning()->parseStatus(frame, dataIndex,
                                                             _outerLoopData->broadcastCounter);
-    _forceActuatorData->primaryCylinderForce[dataIndex] = buffer->readSGL();
+    _forceActuatorData->primaryCylinderForce[dataIndex] = frame.readSGL();
     float x = 0;
     float y = 0;
     float z = 0;
     ForceConverter::saaToMirror(_forceActuatorData->primaryCylinderForce[dataIndex],
                                 _forceActuatorData->secondaryCylinderForce[dataIndex], &x, &y, &z);
     _forceActuatorData->zForce[dataIndex] = z;
-    buffer->skipToNextFrame();
 }
 
-void ILCResponseParser::_parseDualAxisPneumaticForceStatusResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseDualAxisPneumaticForceStatusResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
     int32_t secondaryDataIndex = map.SecondaryDataIndex;
     int xIndex = map.XDataIndex;
     int yIndex = map.YDataIndex;
-    M1M3SSPublisher::getForceActuatorWarning()->parseStatus(buffer, dataIndex,
+    M1M3SSPublisher::getForceActuatorWarning()->parseStatus(frame, dataIndex,
                                                             _outerLoopData->broadcastCounter);
-    _forceActuatorData->primaryCylinderForce[dataIndex] = buffer->readSGL();
-    _forceActuatorData->secondaryCylinderForce[secondaryDataIndex] = buffer->readSGL();
+    _forceActuatorData->primaryCylinderForce[dataIndex] = frame.readSGL();
+    _forceActuatorData->secondaryCylinderForce[secondaryDataIndex] = frame.readSGL();
     float x = 0;
     float y = 0;
     float z = 0;
@@ -769,141 +741,129 @@ void ILCResponseParser::_parseDualAxisPneumaticForceStatusResponse(ModbusBuffer*
         _forceActuatorData->yForce[yIndex] = y;
     }
     _forceActuatorData->zForce[dataIndex] = z;
-    buffer->skipToNextFrame();
 }
 
-void ILCResponseParser::_parseSetHPADCScanRateResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseSetHPADCScanRateResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _hardpointActuatorInfo->adcScanRate[dataIndex] = buffer->readU8();
-    buffer->skipToNextFrame();
+    _hardpointActuatorInfo->adcScanRate[dataIndex] = frame.readU8();
 }
 
-void ILCResponseParser::_parseSetFAADCScanRateResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseSetFAADCScanRateResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _forceActuatorInfo->adcScanRate[dataIndex] = buffer->readU8();
-    buffer->skipToNextFrame();
+    _forceActuatorInfo->adcScanRate[dataIndex] = frame.readU8();
 }
 
-void ILCResponseParser::_parseSetHPADCChannelOffsetAndSensitivityResponse(ModbusBuffer* buffer, ILCMap map) {
-    buffer->skipToNextFrame();
-}
+void ILCResponseParser::_parseSetHPADCChannelOffsetAndSensitivityResponse(ModbusView& frame,
+                                                                          const ILCMap& map) {}
 
-void ILCResponseParser::_parseSetFAADCChannelOffsetAndSensitivityResponse(ModbusBuffer* buffer, ILCMap map) {
-    buffer->skipToNextFrame();
-}
+void ILCResponseParser::_parseSetFAADCChannelOffsetAndSensitivityResponse(ModbusView& frame,
+                                                                          const ILCMap& map) {}
 
-void ILCResponseParser::_parseHPResetResponse(ModbusBuffer* buffer, ILCMap map) { buffer->skipToNextFrame(); }
+void ILCResponseParser::_parseHPResetResponse(ModbusView& frame, const ILCMap& map) {}
 
-void ILCResponseParser::_parseFAResetResponse(ModbusBuffer* buffer, ILCMap map) { buffer->skipToNextFrame(); }
+void ILCResponseParser::_parseFAResetResponse(ModbusView& frame, const ILCMap& map) {}
 
-void ILCResponseParser::_parseHMResetResponse(ModbusBuffer* buffer, ILCMap map) { buffer->skipToNextFrame(); }
+void ILCResponseParser::_parseHMResetResponse(ModbusView& frame, const ILCMap& map) {}
 
-void ILCResponseParser::_parseReadHPCalibrationResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReadHPCalibrationResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    buffer->readSGL();  // Main Coefficient K1
-    buffer->readSGL();  // Main Coefficient K2
-    _hardpointActuatorInfo->mainLoadCellCoefficient[dataIndex] = buffer->readSGL();
-    buffer->readSGL();  // Main Coefficient K4
-    _hardpointActuatorInfo->mainLoadCellOffset[dataIndex] = buffer->readSGL();
-    buffer->readSGL();  // Main Offset Channel 2
-    buffer->readSGL();  // Main Offset Channel 3
-    buffer->readSGL();  // Main Offset Channel 4
-    _hardpointActuatorInfo->mainLoadCellSensitivity[dataIndex] = buffer->readSGL();
-    buffer->readSGL();  // Main Sensitivity Channel 2
-    buffer->readSGL();  // Main Sensitivity Channel 3
-    buffer->readSGL();  // Main Sensitivity Channel 4
-    buffer->readSGL();  // Backup Coefficient K1
-    buffer->readSGL();  // Backup Coefficient K2
-    _hardpointActuatorInfo->backupLoadCellCoefficient[dataIndex] = buffer->readSGL();
-    buffer->readSGL();  // Backup Coefficient K4
-    _hardpointActuatorInfo->backupLoadCellOffset[dataIndex] = buffer->readSGL();
-    buffer->readSGL();  // Backup Offset Channel 2
-    buffer->readSGL();  // Backup Offset Channel 3
-    buffer->readSGL();  // Backup Offset Channel 4
-    _hardpointActuatorInfo->backupLoadCellSensitivity[dataIndex] = buffer->readSGL();
-    buffer->readSGL();  // Backup Sensitivity Channel 2
-    buffer->readSGL();  // Backup Sensitivity Channel 3
-    buffer->readSGL();  // Backup Sensitivity Channel 4
-    buffer->skipToNextFrame();
+    frame.readSGL();  // Main Coefficient K1
+    frame.readSGL();  // Main Coefficient K2
+    _hardpointActuatorInfo->mainLoadCellCoefficient[dataIndex] = frame.readSGL();
+    frame.readSGL();  // Main Coefficient K4
+    _hardpointActuatorInfo->mainLoadCellOffset[dataIndex] = frame.readSGL();
+    frame.readSGL();  // Main Offset Channel 2
+    frame.readSGL();  // Main Offset Channel 3
+    frame.readSGL();  // Main Offset Channel 4
+    _hardpointActuatorInfo->mainLoadCellSensitivity[dataIndex] = frame.readSGL();
+    frame.readSGL();  // Main Sensitivity Channel 2
+    frame.readSGL();  // Main Sensitivity Channel 3
+    frame.readSGL();  // Main Sensitivity Channel 4
+    frame.readSGL();  // Backup Coefficient K1
+    frame.readSGL();  // Backup Coefficient K2
+    _hardpointActuatorInfo->backupLoadCellCoefficient[dataIndex] = frame.readSGL();
+    frame.readSGL();  // Backup Coefficient K4
+    _hardpointActuatorInfo->backupLoadCellOffset[dataIndex] = frame.readSGL();
+    frame.readSGL();  // Backup Offset Channel 2
+    frame.readSGL();  // Backup Offset Channel 3
+    frame.readSGL();  // Backup Offset Channel 4
+    _hardpointActuatorInfo->backupLoadCellSensitivity[dataIndex] = frame.readSGL();
+    frame.readSGL();  // Backup Sensitivity Channel 2
+    frame.readSGL();  // Backup Sensitivity Channel 3
+    frame.readSGL();  // Backup Sensitivity Channel 4
 }
 
-void ILCResponseParser::_parseReadFACalibrationResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReadFACalibrationResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _forceActuatorInfo->mainPrimaryCylinderCoefficient[dataIndex] = buffer->readSGL();
+    _forceActuatorInfo->mainPrimaryCylinderCoefficient[dataIndex] = frame.readSGL();
     _forceActuatorInfo->mainSecondaryCylinderCoefficient[dataIndex] =
             _forceActuatorInfo->mainPrimaryCylinderCoefficient[dataIndex];
-    buffer->readSGL();  // Main Coefficient K2
-    buffer->readSGL();  // Main Coefficient K3
-    buffer->readSGL();  // Main Coefficient K4
-    _forceActuatorInfo->mainPrimaryCylinderLoadCellOffset[dataIndex] = buffer->readSGL();
-    _forceActuatorInfo->mainSecondaryCylinderLoadCellOffset[dataIndex] = buffer->readSGL();
-    buffer->readSGL();  // Main Offset Channel 3
-    buffer->readSGL();  // Main Offset Channel 4
-    _forceActuatorInfo->mainPrimaryCylinderLoadCellSensitivity[dataIndex] = buffer->readSGL();
-    _forceActuatorInfo->mainSecondaryCylinderLoadCellSensitivity[dataIndex] = buffer->readSGL();
-    buffer->readSGL();  // Main Sensitivity Channel 3
-    buffer->readSGL();  // Main Sensitivity Channel 4
-    _forceActuatorInfo->backupPrimaryCylinderCoefficient[dataIndex] = buffer->readSGL();
+    frame.readSGL();  // Main Coefficient K2
+    frame.readSGL();  // Main Coefficient K3
+    frame.readSGL();  // Main Coefficient K4
+    _forceActuatorInfo->mainPrimaryCylinderLoadCellOffset[dataIndex] = frame.readSGL();
+    _forceActuatorInfo->mainSecondaryCylinderLoadCellOffset[dataIndex] = frame.readSGL();
+    frame.readSGL();  // Main Offset Channel 3
+    frame.readSGL();  // Main Offset Channel 4
+    _forceActuatorInfo->mainPrimaryCylinderLoadCellSensitivity[dataIndex] = frame.readSGL();
+    _forceActuatorInfo->mainSecondaryCylinderLoadCellSensitivity[dataIndex] = frame.readSGL();
+    frame.readSGL();  // Main Sensitivity Channel 3
+    frame.readSGL();  // Main Sensitivity Channel 4
+    _forceActuatorInfo->backupPrimaryCylinderCoefficient[dataIndex] = frame.readSGL();
     _forceActuatorInfo->backupSecondaryCylinderCoefficient[dataIndex] =
             _forceActuatorInfo->backupPrimaryCylinderCoefficient[dataIndex];
-    buffer->readSGL();  // Backup Coefficient K2
-    buffer->readSGL();  // Backup Coefficient K3
-    buffer->readSGL();  // Backup Coefficient K4
-    _forceActuatorInfo->backupPrimaryCylinderLoadCellOffset[dataIndex] = buffer->readSGL();
-    _forceActuatorInfo->backupSecondaryCylinderLoadCellOffset[dataIndex] = buffer->readSGL();
-    buffer->readSGL();  // Backup Offset Channel 3
-    buffer->readSGL();  // Backup Offset Channel 4
-    _forceActuatorInfo->backupPrimaryCylinderLoadCellSensitivity[dataIndex] = buffer->readSGL();
-    _forceActuatorInfo->backupSecondaryCylinderLoadCellSensitivity[dataIndex] = buffer->readSGL();
-    buffer->readSGL();  // Backup Sensitivity Channel 3
-    buffer->readSGL();  // Backup Sensitivity Channel 4
-    buffer->skipToNextFrame();
+    frame.readSGL();  // Backup Coefficient K2
+    frame.readSGL();  // Backup Coefficient K3
+    frame.readSGL();  // Backup Coefficient K4
+    _forceActuatorInfo->backupPrimaryCylinderLoadCellOffset[dataIndex] = frame.readSGL();
+    _forceActuatorInfo->backupSecondaryCylinderLoadCellOffset[dataIndex] = frame.readSGL();
+    frame.readSGL();  // Backup Offset Channel 3
+    frame.readSGL();  // Backup Offset Channel 4
+    _forceActuatorInfo->backupPrimaryCylinderLoadCellSensitivity[dataIndex] = frame.readSGL();
+    _forceActuatorInfo->backupSecondaryCylinderLoadCellSensitivity[dataIndex] = frame.readSGL();
+    frame.readSGL();  // Backup Sensitivity Channel 3
+    frame.readSGL();  // Backup Sensitivity Channel 4
 }
 
-void ILCResponseParser::_parseReadDCAPressureValuesResponse(ModbusBuffer* buffer, ILCMap map) {
-    buffer->readSGL();
-    buffer->readSGL();
-    buffer->readSGL();
-    buffer->readSGL();
-    buffer->skipToNextFrame();
+void ILCResponseParser::_parseReadDCAPressureValuesResponse(ModbusView& frame, const ILCMap& map) {
+    frame.readSGL();
+    frame.readSGL();
+    frame.readSGL();
+    frame.readSGL();
 }
 
-void ILCResponseParser::_parseReadHMPressureValuesResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReadHMPressureValuesResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _hardpointMonitorData->pressureSensor1[dataIndex] = buffer->readSGL();
-    _hardpointMonitorData->pressureSensor2[dataIndex] = buffer->readSGL();
-    _hardpointMonitorData->pressureSensor3[dataIndex] = buffer->readSGL();
-    _hardpointMonitorData->breakawayPressure[dataIndex] = buffer->readSGL();
-    buffer->skipToNextFrame();
+    _hardpointMonitorData->pressureSensor1[dataIndex] = frame.readSGL();
+    _hardpointMonitorData->pressureSensor2[dataIndex] = frame.readSGL();
+    _hardpointMonitorData->pressureSensor3[dataIndex] = frame.readSGL();
+    _hardpointMonitorData->breakawayPressure[dataIndex] = frame.readSGL();
     _checkHardpointActuatorAirPressure(dataIndex);
 }
 
-void ILCResponseParser::_parseReportDCAIDResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReportDCAIDResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _forceActuatorInfo->mezzanineUniqueId[dataIndex] = buffer->readU48();
-    _forceActuatorInfo->mezzanineFirmwareType[dataIndex] = buffer->readU8();
-    _forceActuatorInfo->mezzanineMajorRevision[dataIndex] = buffer->readU8();
-    _forceActuatorInfo->mezzanineMinorRevision[dataIndex] = buffer->readU8();
-    buffer->skipToNextFrame();
+    _forceActuatorInfo->mezzanineUniqueId[dataIndex] = frame.readU48();
+    _forceActuatorInfo->mezzanineFirmwareType[dataIndex] = frame.readU8();
+    _forceActuatorInfo->mezzanineMajorRevision[dataIndex] = frame.readU8();
+    _forceActuatorInfo->mezzanineMinorRevision[dataIndex] = frame.readU8();
 }
 
-void ILCResponseParser::_parseReportHMMezzanineIDResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReportHMMezzanineIDResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _hardpointMonitorInfo->mezzanineUniqueId[dataIndex] = buffer->readU48();
-    _hardpointMonitorInfo->mezzanineFirmwareType[dataIndex] = buffer->readU8();
-    _hardpointMonitorInfo->mezzanineMajorRevision[dataIndex] = buffer->readU8();
-    _hardpointMonitorInfo->mezzanineMinorRevision[dataIndex] = buffer->readU8();
-    buffer->skipToNextFrame();
+    _hardpointMonitorInfo->mezzanineUniqueId[dataIndex] = frame.readU48();
+    _hardpointMonitorInfo->mezzanineFirmwareType[dataIndex] = frame.readU8();
+    _hardpointMonitorInfo->mezzanineMajorRevision[dataIndex] = frame.readU8();
+    _hardpointMonitorInfo->mezzanineMinorRevision[dataIndex] = frame.readU8();
 }
 
-void ILCResponseParser::_parseReportDCAStatusResponse(ModbusBuffer* buffer, ILCMap map) {
-    M1M3SSPublisher::getForceActuatorWarning()->parseDCAStatus(buffer, map.DataIndex);
-    buffer->skipToNextFrame();
+void ILCResponseParser::_parseReportDCAStatusResponse(ModbusView& frame, const ILCMap& map) {
+    M1M3SSPublisher::getForceActuatorWarning()->parseDCAStatus(frame, map.DataIndex);
 }
 
-void ILCResponseParser::_parseReportHMMezzanineStatusResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReportHMMezzanineStatusResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    uint16_t status = buffer->readU16();
+    uint16_t status = frame.readU16();
     _hardpointMonitorWarning->mezzanineS1AInterface1Fault[dataIndex] = (status & 0x0001) != 0;
     _hardpointMonitorWarning->mezzanineS1ALVDT1Fault[dataIndex] = (status & 0x0002) != 0;
     _hardpointMonitorWarning->mezzanineS1AInterface2Fault[dataIndex] = (status & 0x0004) != 0;
@@ -920,17 +880,15 @@ void ILCResponseParser::_parseReportHMMezzanineStatusResponse(ModbusBuffer* buff
     _hardpointMonitorWarning->mezzanineApplicationCRCMismatch[dataIndex] = (status & 0x2000) != 0;
     // 0x4000 is reserved
     _hardpointMonitorWarning->mezzanineBootloaderActive[dataIndex] = (status & 0x8000) != 0;
-    buffer->skipToNextFrame();
 }
 
-void ILCResponseParser::_parseReportLVDTResponse(ModbusBuffer* buffer, ILCMap map) {
+void ILCResponseParser::_parseReportLVDTResponse(ModbusView& frame, const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
-    _hardpointMonitorData->breakawayLVDT[dataIndex] = buffer->readSGL();
-    _hardpointMonitorData->displacementLVDT[dataIndex] = buffer->readSGL();
-    buffer->skipToNextFrame();
+    _hardpointMonitorData->breakawayLVDT[dataIndex] = frame.readSGL();
+    _hardpointMonitorData->displacementLVDT[dataIndex] = frame.readSGL();
 }
 
-void ILCResponseParser::_checkForceActuatorMeasuredForce(ILCMap map) {
+void ILCResponseParser::_checkForceActuatorMeasuredForce(const ILCMap& map) {
     int32_t dataIndex = map.DataIndex;
     int32_t secondaryDataIndex = map.SecondaryDataIndex;
     float primaryForce = _forceActuatorData->primaryCylinderForce[dataIndex];
@@ -959,7 +917,7 @@ void ILCResponseParser::_checkForceActuatorMeasuredForce(ILCMap map) {
     }
 }
 
-void ILCResponseParser::_checkForceActuatorFollowingError(ILCMap map) {
+void ILCResponseParser::_checkForceActuatorFollowingError(const ILCMap& map) {
     // TODO: UPDATE
     int32_t dataIndex = map.DataIndex;
     int32_t secondaryDataIndex = map.SecondaryDataIndex;
@@ -29,7 +29,9 @@
 #include <ForceActuatorSettings.h>
 #include <ILCSubnetData.h>
 #include <ILCDataTypes.h>
+#include <ILCFrameIndexer.h>
 #include <ModbusBuffer.h>
+#include <ModbusView.h>
 #include <SafetyController.h>
 #include <SAL_MTM1M3C.h>
 
@@ -50,44 +52,46 @@ public:
     void verifyResponses();
 
 private:
-    void _parseErrorResponse(ModbusBuffer* buffer, double timestamp, int32_t actuatorId);
-    void _parseReportHPServerIDResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReportFAServerIDResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReportHMServerIDResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReportHPServerStatusResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReportFAServerStatusResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReportHMServerStatusResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseChangeHPILCModeResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseChangeFAILCModeResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseChangeHMILCModeResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseElectromechanicalForceAndStatusResponse(ModbusBuffer* buffer, ILCMap map, double timestamp);
-    void _parseSetBoostValveDCAGainsResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReadBoostValveDCAGainsResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseForceDemandResponse(ModbusBuffer* buffer, uint8_t address, ILCMap map);
-    void _parseSingleAxisForceDemandResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseDualAxisForceDemandResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parsePneumaticForceStatusResponse(ModbusBuffer* buffer, uint8_t address, ILCMap map);
-    void _parseSingleAxisPneumaticForceStatusResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseDualAxisPneumaticForceStatusResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseSetHPADCScanRateResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseSetFAADCScanRateResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseSetHPADCChannelOffsetAndSensitivityResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseSetFAADCChannelOffsetAndSensitivityResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseHPResetResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseFAResetResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseHMResetResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReadHPCalibrationResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReadFACalibrationResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReadDCAPressureValuesResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReadHMPressureValuesResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReportDCAIDResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReportHMMezzanineIDResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReportDCAStatusResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReportHMMezzanineStatusResponse(ModbusBuffer* buffer, ILCMap map);
-    void _parseReportLVDTResponse(ModbusBuffer* buffer, ILCMap map);
-
-    void _checkForceActuatorMeasuredForce(ILCMap map);
-    void _checkForceActuatorFollowingError(ILCMap map);
+    void _parseFrame(const ILCResponseFrame& response, ModbusView& frame, uint8_t subnet);
+    void _parseErrorResponse(ModbusView& frame, double timestamp, int32_t actuatorId);
+    void _parseReportHPServerIDResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReportFAServerIDResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReportHMServerIDResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReportHPServerStatusResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReportFAServerStatusResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReportHMServerStatusResponse(ModbusView& frame, const ILCMap& map);
+    void _parseChangeHPILCModeResponse(ModbusView& frame, const ILCMap& map);
+    void _parseChangeFAILCModeResponse(ModbusView& frame, const ILCMap& map);
+    void _parseChangeHMILCModeResponse(ModbusView& frame, const ILCMap& map);
+    void _parseElectromechanicalForceAndStatusResponse(ModbusView& frame, const ILCMap& map,
+                                                       double timestamp);
+    void _parseSetBoostValveDCAGainsResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReadBoostValveDCAGainsResponse(ModbusView& frame, const ILCMap& map);
+    void _parseForceDemandResponse(ModbusView& frame, uint8_t address, const ILCMap& map);
+    void _parseSingleAxisForceDemandResponse(ModbusView& frame, const ILCMap& map);
+    void _parseDualAxisForceDemandResponse(ModbusView& frame, const ILCMap& map);
+    void _parsePneumaticForceStatusResponse(ModbusView& frame, uint8_t address, const ILCMap& map);
+    void _parseSingleAxisPneumaticForceStatusResponse(ModbusView& frame, const ILCMap& map);
+    void _parseDualAxisPneumaticForceStatusResponse(ModbusView& frame, const ILCMap& map);
+    void _parseSetHPADCScanRateResponse(ModbusView& frame, const ILCMap& map);
+    void _parseSetFAADCScanRateResponse(ModbusView& frame, const ILCMap& map);
+    void _parseSetHPADCChannelOffsetAndSensitivityResponse(ModbusView& frame, const ILCMap& map);
+    void _parseSetFAADCChannelOffsetAndSensitivityResponse(ModbusView& frame, const ILCMap& map);
+    void _parseHPResetResponse(ModbusView& frame, const ILCMap& map);
+    void _parseFAResetResponse(ModbusView& frame, const ILCMap& map);
+    void _parseHMResetResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReadHPCalibrationResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReadFACalibrationResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReadDCAPressureValuesResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReadHMPressureValuesResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReportDCAIDResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReportHMMezzanineIDResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReportDCAStatusResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReportHMMezzanineStatusResponse(ModbusView& frame, const ILCMap& map);
+    void _parseReportLVDTResponse(ModbusView& frame, const ILCMap& map);
+
+    void _checkForceActuatorMeasuredForce(const ILCMap& map);
+    void _checkForceActuatorFollowingError(const ILCMap& map);
     void _checkHardpointActuatorMeasuredForce(int32_t actuatorId);
     void _checkHardpointActuatorAirPressure(int32_t actuatorId);
 
@@ -106,6 +110,7 @@ private:
     HardpointActuatorSettings* _hardpointActuatorSettings;
     ForceActuatorSettings* _forceActuatorSettings;
     ILCSubnetData* _subnetData;
+    ILCFrameIndexer _frameIndexer;
     SafetyController* _safetyController;
 
     int32_t _faExpectedResponses[FA_COUNT];
@@ -42,6 +42,10 @@ ILCSubnetData::ILCSubnetData(ForceActuatorApplicationSettings* forceActuatorAppl
         this->subnetData[subnetIndex].FACount = 0;
         this->subnetData[subnetIndex].HPCount = 0;
         this->subnetData[subnetIndex].HMCount = 0;
+        this->subnetData[subnetIndex].FADisabledMask = 0;
+    }
+    for (int i = 0; i < FA_ID_LIMIT; i++) {
+        _faZIndex[i] = -1;
     }
     for (int i = 0; i < FA_COUNT; i++) {
         ForceActuatorTableRow row = _forceActuatorApplicationSettings->Table[i];
@@ -61,6 +65,12 @@ ILCSubnetData::ILCSubnetData(ForceActuatorApplicationSettings* forceActuatorAppl
         ILCMap map = this->subnetData[subnetIndex].ILCDataFromAddress[row.Address];
         this->subnetData[subnetIndex].FAIndex.push_back(map);
         this->subnetData[subnetIndex].FACount += 1;
+        this->subnetData[subnetIndex].FAAddresses.push_back(map.Address);
+        this->subnetData[subnetIndex].FADataIndices.push_back(map.DataIndex);
+        this->subnetData[subnetIndex].FASecondaryDataIndices.push_back(map.SecondaryDataIndex);
+        if (row.ActuatorID >= 0 && row.ActuatorID < FA_ID_LIMIT) {
+            _faZIndex[row.ActuatorID] = i;
+        }
     }
     for (int i = 0; i < HP_COUNT; i++) {
         HardpointActuatorTableRow row = hardpointActuatorApplicationSettings->Table[i];
@@ -98,7 +108,7 @@ ILCSubnetData::ILCSubnetData(ForceActuatorApplicationSettings* forceActuatorAppl
 
 ILCMap ILCSubnetData::getMap(int32_t actuatorId) {
     for (int subnetIndex = 0; subnetIndex < 5; ++subnetIndex) {
-        Container container = this->subnetData[subnetIndex];
+        const Container& container = this->subnetData[subnetIndex];
         for (int i = 0; i < container.HPCount; ++i) {
             if (container.HPIndex[i].ActuatorId == actuatorId) {
                 return container.HPIndex[i];
@@ -121,12 +131,27 @@ ILCMap ILCSubnetData::getMap(int32_t actuatorId) {
     return none;
 }
 
+int32_t ILCSubnetData::findEnabledFA(int32_t subnetIndex, int32_t faIndex) const {
+    const Container& container = this->subnetData[subnetIndex];
+    if (container.FACount == 0) {
+        return -1;
+    }
+    uint64_t enabled = ~container.FADisabledMask & (((uint64_t)1 << container.FACount) - 1);
+    if (enabled == 0) {
+        return -1;
+    }
+    uint64_t fromIndex = enabled & ~(((uint64_t)1 << faIndex) - 1);
+    return __builtin_ctzll(fromIndex != 0 ? fromIndex : enabled);
+}
+
 void ILCSubnetData::disableFA(int32_t actuatorId) {
     for (int subnetIndex = 0; subnetIndex < 5; ++subnetIndex) {
         Container* container = &subnetData[subnetIndex];
         for (int i = 0; i < container->FACount; ++i) {
             if (container->FAIndex[i].ActuatorId == actuatorId) {
                 container->FAIndex[i].Disabled = true;
+                container->FADisabledMask |= (uint64_t)1 << i;
+                _faDisabled.set(container->FAIndex[i].DataIndex);
                 SPDLOG_INFO("ILCSubnetData::disableFA({}, {}, {}) actuator disabled", actuatorId, subnetIndex,
                             i);
                 return;
@@ -142,6 +167,8 @@ void ILCSubnetData::enableFA(int32_t actuatorId) {
         for (int i = 0; i < container->FACount; ++i) {
             if (container->FAIndex[i].ActuatorId == actuatorId) {
                 container->FAIndex[i].Disabled = false;
+                container->FADisabledMask &= ~((uint64_t)1 << i);
+                _faDisabled.reset(container->FAIndex[i].DataIndex);
                 SPDLOG_INFO("ILCSubnetData::enableFA({}, {}, {}) actuator enabled", actuatorId, subnetIndex,
                             i);
                 return;
@@ -157,7 +184,9 @@ void ILCSubnetData::enableAllFA() {
         for (int i = 0; i < container->FACount; ++i) {
             container->FAIndex[i].Disabled = false;
         }
+        container->FADisabledMask = 0;
     }
+    _faDisabled.reset();
     SPDLOG_INFO("ILCSubnetData::enableAllFA()");
 }
 
@@ -25,6 +25,8 @@
 #define ILCSUBNETDATA_H_
 
 #include <ILCDataTypes.h>
+#include <bitset>
+#include <vector>
 
 namespace LSST {
 namespace M1M3 {
@@ -35,6 +37,11 @@ class ForceActuatorSettings;
 class HardpointActuatorApplicationSettings;
 class HardpointMonitorApplicationSettings;
 
+/**
+ * ILCs on subnets. Besides ILCMap records, addresses and data indices of force
+ * actuators are stored in contiguous per-subnet arrays (structure of arrays),
+ * so loops over subnet's actuators stream through compact memory.
+ */
 class ILCSubnetData {
     struct Container {
         int32_t HPCount;
@@ -44,6 +51,12 @@ class ILCSubnetData {
         int32_t HMCount;
         std::vector<ILCMap> HMIndex;
         ILCMap ILCDataFromAddress[256];
+
+        // force actuators structure of arrays, indexed by FA index on subnet
+        std::vector<uint8_t> FAAddresses;
+        std::vector<int32_t> FADataIndices;
+        std::vector<int32_t> FASecondaryDataIndices;
+        uint64_t FADisabledMask;
     };
     Container subnetData[5];
 
@@ -53,22 +66,101 @@ public:
                   HardpointActuatorApplicationSettings* hardpointActuatorApplicationSettings,
                   HardpointMonitorApplicationSettings* hardpointMonitorApplicationSettings);
 
-    int32_t getHPCount(int32_t subnetIndex) { return this->subnetData[subnetIndex].HPIndex.size(); }
-    ILCMap getHPIndex(int32_t subnetIndex, int32_t hpIndex) {
+    int32_t getHPCount(int32_t subnetIndex) const { return this->subnetData[subnetIndex].HPIndex.size(); }
+    const ILCMap& getHPIndex(int32_t subnetIndex, int32_t hpIndex) const {
         return this->subnetData[subnetIndex].HPIndex[hpIndex];
     }
-    int32_t getFACount(int32_t subnetIndex) { return this->subnetData[subnetIndex].FAIndex.size(); }
-    ILCMap getFAIndex(int32_t subnetIndex, int32_t faIndex) {
+    int32_t getFACount(int32_t subnetIndex) const { return this->subnetData[subnetIndex].FAIndex.size(); }
+    const ILCMap& getFAIndex(int32_t subnetIndex, int32_t faIndex) const {
         return this->subnetData[subnetIndex].FAIndex[faIndex];
     }
-    int32_t getHMCount(int32_t subnetIndex) { return this->subnetData[subnetIndex].HMIndex.size(); }
-    ILCMap getHMIndex(int32_t subnetIndex, int32_t hmIndex) {
+    int32_t getHMCount(int32_t subnetIndex) const { return this->subnetData[subnetIndex].HMIndex.size(); }
+    const ILCMap& getHMIndex(int32_t subnetIndex, int32_t hmIndex) const {
         return this->subnetData[subnetIndex].HMIndex[hmIndex];
     }
-    ILCMap getILCDataFromAddress(int32_t subnetIndex, uint8_t address) {
+    const ILCMap& getILCDataFromAddress(int32_t subnetIndex, uint8_t address) const {
         return this->subnetData[subnetIndex].ILCDataFromAddress[address];
     }
 
+    /**
+     * Returns addresses of force actuators on subnet.
+     *
+     * @param subnetIndex subnet index (0-4)
+     *
+     * @return addresses, indexed by FA index on subnet (0..getFACount() - 1)
+     */
+    const std::vector<uint8_t>& getFAAddresses(int32_t subnetIndex) const {
+        return this->subnetData[subnetIndex].FAAddresses;
+    }
+
+    /**
+     * Returns primary (Z) data indices of force actuators on subnet.
+     *
+     * @param subnetIndex subnet index (0-4)
+     *
+     * @return Z indices (0-155), indexed by FA index on subnet
+     */
+    const std::vector<int32_t>& getFADataIndices(int32_t subnetIndex) const {
+        return this->subnetData[subnetIndex].FADataIndices;
+    }
+
+    /**
+     * Returns secondary cylinder data indices of force actuators on subnet.
+     *
+     * @param subnetIndex subnet index (0-4)
+     *
+     * @return secondary indices (-1 for single axis, 0-111), indexed by FA
+     * index on subnet
+     */
+    const std::vector<int32_t>& getFASecondaryDataIndices(int32_t subnetIndex) const {
+        return this->subnetData[subnetIndex].FASecondaryDataIndices;
+    }
+
+    /**
+     * Returns disabled force actuators on subnet. Bit n is set when FA with
+     * index n on subnet is disabled. As subnet FA addresses are 1-48, 64 bits
+     * are enough.
+     *
+     * @param subnetIndex subnet index (0-4)
+     *
+     * @return disabled FA bitmask
+     */
+    uint64_t getFADisabledMask(int32_t subnetIndex) const {
+        return this->subnetData[subnetIndex].FADisabledMask;
+    }
+
+    /**
+     * Finds enabled force actuator on subnet. Searches from faIndex, wraps
+     * around after the last FA. Uses bit scan over disabled FA mask, so it
+     * takes constant time regardless of number of disabled FAs.
+     *
+     * @param subnetIndex subnet index (0-4)
+     * @param faIndex FA index on subnet where search starts
+     *
+     * @return faIndex if that FA is enabled, index of the next enabled FA
+     * otherwise. -1 when all FAs on subnet are disabled.
+     */
+    int32_t findEnabledFA(int32_t subnetIndex, int32_t faIndex) const;
+
+    /**
+     * Returns whether ILC is disabled. Only force actuators can be disabled.
+     *
+     * @param actuatorId actuator ID
+     *
+     * @return true if actuator with given ID is disabled FA
+     */
+    bool isDisabled(int32_t actuatorId) const {
+        return actuatorId >= 0 && actuatorId < FA_ID_LIMIT && _faZIndex[actuatorId] >= 0 &&
+               _faDisabled[_faZIndex[actuatorId]];
+    }
+
+    /**
+     * Returns disabled force actuators.
+     *
+     * @return bitset with bit set for disabled FA Z index
+     */
+    const std::bitset<FA_COUNT>& getFADisabled() const { return _faDisabled; }
+
     /**
      * Returns ILCMap for actuator with given ID.
      *
@@ -84,7 +176,13 @@ public:
     void enableAllFA();
 
 private:
+    // FA actuator IDs are 101-443
+    static constexpr int FA_ID_LIMIT = 444;
+
     ForceActuatorApplicationSettings* _forceActuatorApplicationSettings;
+
+    int16_t _faZIndex[FA_ID_LIMIT];
+    std::bitset<FA_COUNT> _faDisabled;
 };
 
 } /* namespace SS */
@@ -113,6 +113,7 @@ struct FaultCodes {
         RaiseOperationTimeout = _MASK_TIMEOUTS | 0x01,              // 6108
         LowerOperationTimeout = _MASK_TIMEOUTS | 0x02,              // 6109
         ILCCommunicationTimeout = _MASK_TIMEOUTS | 0x03,            // 6110
+        OuterLoopDeadlineMiss = _MASK_TIMEOUTS | 0x04,              // 6113
         ForceActuatorFollowingError = _MASK_FORCE_ACTUATOR | 0x01,  // 6111
         HardpointActuator = _MASK_HARDPOINT | 0x01,                 // 6112
         HardpointActuatorLoadCellError = _MASK_HARDPOINT | 0x02,
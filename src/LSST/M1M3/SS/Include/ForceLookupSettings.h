@@ -0,0 +1,68 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSST_M1M3_SS_INCLUDE_FORCELOOKUPSETTINGS_H_
+#define LSST_M1M3_SS_INCLUDE_FORCELOOKUPSETTINGS_H_
+
+#include <stdexcept>
+#include <string>
+
+#include <yaml-cpp/yaml.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Settings for precomputed force lookup grid. Forces between grid points are
+ * linearly interpolated. Grid is used only if the interpolation error
+ * (checked against polynomial at settings load) stays below MaxError.
+ */
+struct ForceLookupSettings {
+    bool Enabled;
+    /// grid range (polynomial variable, degrees)
+    float Min;
+    float Max;
+    /// grid step (degrees)
+    float Step;
+    /// maximal allowed interpolation error (N)
+    float MaxError;
+
+    void set(YAML::Node node, float min, float max) {
+        Enabled = node["Enabled"].as<bool>(false);
+        Min = node["Min"].as<float>(min);
+        Max = node["Max"].as<float>(max);
+        Step = node["Step"].as<float>(0.01);
+        MaxError = node["MaxError"].as<float>(0.01);
+        if (Enabled && (Step <= 0 || Max <= Min)) {
+            throw std::runtime_error("Invalid force lookup grid range " + std::to_string(Min) + " - " +
+                                     std::to_string(Max) + " step " + std::to_string(Step));
+        }
+    }
+};
+
+}  // namespace SS
+}  // namespace M1M3
+}  // namespace LSST
+
+#endif /* LSST_M1M3_SS_INCLUDE_FORCELOOKUPSETTINGS_H_ */
@@ -133,6 +133,8 @@ void Model::loadSettings(std::string settingsToApply) {
     PIDSettings* pidSettings = SettingReader::instance().loadPIDSettings();
     SPDLOG_INFO("Model: Loading inclinometer settings");
     InclinometerSettings* inclinometerSettings = SettingReader::instance().loadInclinometerSettings();
+    SPDLOG_INFO("Model: Loading outer loop application settings");
+    SettingReader::instance().loadOuterLoopApplicationSettings();
 
     _populateForceActuatorInfo(forceActuatorApplicationSettings, forceActuatorSettings);
     _populateHardpointActuatorInfo(hardpointActuatorApplicationSettings, hardpointActuatorSettings,
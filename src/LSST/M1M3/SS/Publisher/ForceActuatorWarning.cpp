@@ -35,8 +35,8 @@ ForceActuatorWarning::ForceActuatorWarning() {
     _shouldSend = false;
 }
 
-void ForceActuatorWarning::parseFAServerStatusResponse(ModbusBuffer* buffer, int32_t dataIndex) {
-    uint16_t ilcStatus = buffer->readU16();
+void ForceActuatorWarning::parseFAServerStatusResponse(ModbusView& frame, int32_t dataIndex) {
+    uint16_t ilcStatus = frame.readU16();
     if (_lastFAServerStatusResponse[dataIndex] == ilcStatus) {
         return;
     }
@@ -56,7 +56,7 @@ void ForceActuatorWarning::parseFAServerStatusResponse(ModbusBuffer* buffer, int
     mezzanineError[dataIndex] = (ilcStatus & 0x2000) != 0;
     mezzanineBootloaderActive[dataIndex] = (ilcStatus & 0x4000) != 0;
     // 0x8000 is reserved
-    uint16_t ilcFaults = buffer->readU16();
+    uint16_t ilcFaults = frame.readU16();
     uniqueIdCRCError[dataIndex] = (ilcFaults & 0x0001) != 0;
     applicationTypeMismatch[dataIndex] = (ilcFaults & 0x0002) != 0;
     applicationMissing[dataIndex] = (ilcFaults & 0x0004) != 0;
@@ -77,9 +77,9 @@ void ForceActuatorWarning::parseFAServerStatusResponse(ModbusBuffer* buffer, int
     _shouldSend = true;
 }
 
-void ForceActuatorWarning::parseStatus(ModbusBuffer* buffer, const int32_t dataIndex,
+void ForceActuatorWarning::parseStatus(ModbusView& frame, const int32_t dataIndex,
                                        DDS::Short broadcastCounter) {
-    uint8_t ilcStatus = buffer->readU8();
+    uint8_t ilcStatus = frame.readU8();
     bool brCntWarning = broadcastCounter != ((ilcStatus & 0xF0) >> 4);
     // bit 0x10 becomes brCntWarning
     ilcStatus = (ilcStatus & ~0xF0) | (brCntWarning ? 0x10 : 0x00);
@@ -95,8 +95,8 @@ void ForceActuatorWarning::parseStatus(ModbusBuffer* buffer, const int32_t dataI
     _shouldSend = true;
 }
 
-void ForceActuatorWarning::parseDCAStatus(ModbusBuffer* buffer, int32_t dataIndex) {
-    uint16_t dcaStatus = buffer->readU16();
+void ForceActuatorWarning::parseDCAStatus(ModbusView& frame, int32_t dataIndex) {
+    uint16_t dcaStatus = frame.readU16();
     if (_lastDCAStatus[dataIndex] == dcaStatus) {
         return;
     }
@@ -27,7 +27,7 @@
 #include <SAL_MTM1M3.h>
 
 #include <ILCDataTypes.h>
-#include <ModbusBuffer.h>
+#include <ModbusView.h>
 
 #include <string.h>
 
@@ -59,27 +59,27 @@ public:
     /**
      * Parses FA server status (included in response to function code 18).
      *
-     * @param buffer receiving buffer
+     * @param frame response frame
      * @param dataIndex FA index
      */
-    void parseFAServerStatusResponse(ModbusBuffer *buffer, int32_t dataIndex);
+    void parseFAServerStatusResponse(ModbusView& frame, int32_t dataIndex);
 
     /**
      * Parses FA status (included in response to function code 75).
      *
-     * @param buffer receiving buffer
+     * @param frame response frame
      * @param dataIndex FA index
      * @param broadcastCounter actual (expected) value of broadcast counter
      */
-    void parseStatus(ModbusBuffer *buffer, int32_t dataIndex, const DDS::Short broadcastCounter);
+    void parseStatus(ModbusView& frame, int32_t dataIndex, const DDS::Short broadcastCounter);
 
     /**
      * Parses DCA status (included in response to function code 121).
      *
-     * @param buffer receiving buffer
+     * @param frame response frame
      * @param dataIndex FA index
      */
-    void parseDCAStatus(ModbusBuffer *buffer, int32_t dataIndex);
+    void parseDCAStatus(ModbusView& frame, int32_t dataIndex);
 
     /**
      * Sends updates through SAL/DDS.
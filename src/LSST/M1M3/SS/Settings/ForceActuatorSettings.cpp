@@ -27,6 +27,7 @@
 #include <Model.h>
 #include <yaml-cpp/yaml.h>
 #include <TableLoader.h>
+#include <ForceConverter.h>
 #include <spdlog/spdlog.h>
 #include <algorithm>
 
@@ -78,6 +79,7 @@ void ForceActuatorSettings::load(const std::string &filename) {
         TableLoader::loadTable(1, 1, 3, &VelocityZTable, doc["VelocityZTablePath"].as<std::string>());
         TableLoader::loadTable(1, 1, 3, &VelocityXZTable, doc["VelocityXZTablePath"].as<std::string>());
         TableLoader::loadTable(1, 1, 3, &VelocityYZTable, doc["VelocityYZTablePath"].as<std::string>());
+        transposeTables();
 
         TableLoader::loadLimitTable(1, 1, &AccelerationLimitXTable,
                                     doc["AccelerationLimitXTablePath"].as<std::string>());
@@ -182,6 +184,10 @@ void ForceActuatorSettings::load(const std::string &filename) {
         VelocityComponentSettings.set(doc["VelocityForceComponent"]);
         FinalComponentSettings.set(doc["FinalForceComponent"]);
 
+        ElevationLookupSettings.set(doc["ElevationLookup"], 0, 90);
+        AzimuthLookupSettings.set(doc["AzimuthLookup"], -270, 270);
+        buildLookups();
+
         auto bumpTest = doc["BumpTest"];
 
         TestedTolerances.set(bumpTest["TestedTolerances"]);
@@ -198,6 +204,37 @@ void ForceActuatorSettings::load(const std::string &filename) {
 
 void ForceActuatorSettings::log() { M1M3SSPublisher::get().logForceActuatorSettings(this); }
 
+void ForceActuatorSettings::transposeTables() {
+    AccelerationXTransposed.set(AccelerationXTable, 3);
+    AccelerationYTransposed.set(AccelerationYTable, 3);
+    AccelerationZTransposed.set(AccelerationZTable, 3);
+    AzimuthXTransposed.set(AzimuthXTable, 6);
+    AzimuthYTransposed.set(AzimuthYTable, 6);
+    AzimuthZTransposed.set(AzimuthZTable, 6);
+    ElevationXTransposed.set(ElevationXTable, 6);
+    ElevationYTransposed.set(ElevationYTable, 6);
+    ElevationZTransposed.set(ElevationZTable, 6);
+    ThermalXTransposed.set(ThermalXTable, 6);
+    ThermalYTransposed.set(ThermalYTable, 6);
+    ThermalZTransposed.set(ThermalZTable, 6);
+    VelocityXTransposed.set(VelocityXTable, 3);
+    VelocityYTransposed.set(VelocityYTable, 3);
+    VelocityZTransposed.set(VelocityZTable, 3);
+    VelocityXZTransposed.set(VelocityXZTable, 3);
+    VelocityYZTransposed.set(VelocityYZTable, 3);
+}
+
+void ForceActuatorSettings::buildLookups() {
+    _buildLookup("Elevation", ElevationLookupSettings, ElevationLookup,
+                 [this](float angle, DistributedForces &forces) {
+                     forces = ForceConverter::calculateForceFromElevationAngle(this, angle);
+                 });
+    _buildLookup("Azimuth", AzimuthLookupSettings, AzimuthLookup,
+                 [this](float angle, DistributedForces &forces) {
+                     forces = ForceConverter::calculateForceFromAzimuthAngle(this, angle);
+                 });
+}
+
 void ForceActuatorSettings::_loadNearNeighborZTable(const std::string &filename) {
     typedef boost::tokenizer<boost::escaped_list_separator<char>> tokenizer;
     std::string fullname = SettingReader::instance().getFilePath(filename);
@@ -231,6 +268,26 @@ void ForceActuatorSettings::_loadNearNeighborZTable(const std::string &filename)
     inputStream.close();
 }
 
+void ForceActuatorSettings::_buildLookup(const char *name, const ForceLookupSettings &settings,
+                                         ForceLookupGrid &grid, const ForceLookupGrid::Evaluator &evaluate) {
+    // ForceConverter uses polynomials while the grid is empty
+    grid.clear();
+    if (!settings.Enabled) {
+        return;
+    }
+    ForceLookupGrid built;
+    built.build(settings.Min, settings.Max, settings.Step, evaluate);
+    float error = built.verify(evaluate);
+    if (error > settings.MaxError) {
+        SPDLOG_WARN("{} lookup grid interpolation error {:.4f} N exceeds {:.4f} N, using polynomials", name,
+                    error, settings.MaxError);
+        return;
+    }
+    SPDLOG_INFO("{} lookup grid {} points, {:.1f} MB, interpolation error {:.4f} N", name, built.size(),
+                built.memorySize() / 1e6, error);
+    grid = std::move(built);
+}
+
 void ForceActuatorSettings::_loadNeighborsTable(const std::string &filename) {
     typedef boost::tokenizer<boost::escaped_list_separator<char>> tokenizer;
     std::string fullname = SettingReader::instance().getFilePath(filename);
@@ -26,9 +26,12 @@
 
 #include <SAL_MTM1M3.h>
 
+#include <CoefficientTable.h>
 #include <DataTypes.h>
 #include <ForceActuatorLimits.h>
 #include <ForceComponentSettings.h>
+#include <ForceLookupGrid.h>
+#include <ForceLookupSettings.h>
 #include <ForceActuatorBumpTestSettings.h>
 #include <Limit.h>
 #include <string>
@@ -64,6 +67,21 @@ public:
      */
     void log();
 
+    /**
+     * Fills coefficient-major copies of acceleration, azimuth, elevation,
+     * thermal and velocity tables, used by ForceConverter vectorized
+     * kernels. Called from load, must be called when the tables are modified.
+     */
+    void transposeTables();
+
+    /**
+     * Builds elevation and azimuth lookup grids enabled in settings. Grid
+     * whose interpolation error exceeds configured bound isn't used, forces
+     * are then calculated from polynomials. Called from load, must be called
+     * when the tables or lookup settings are modified.
+     */
+    void buildLookups();
+
     std::vector<float> AccelerationXTable;
     std::vector<float> AccelerationYTable;
     std::vector<float> AccelerationZTable;
@@ -92,6 +110,24 @@ public:
     std::vector<float> VelocityXZTable;
     std::vector<float> VelocityYZTable;
 
+    CoefficientTable AccelerationXTransposed;
+    CoefficientTable AccelerationYTransposed;
+    CoefficientTable AccelerationZTransposed;
+    CoefficientTable AzimuthXTransposed;
+    CoefficientTable AzimuthYTransposed;
+    CoefficientTable AzimuthZTransposed;
+    CoefficientTable ElevationXTransposed;
+    CoefficientTable ElevationYTransposed;
+    CoefficientTable ElevationZTransposed;
+    CoefficientTable ThermalXTransposed;
+    CoefficientTable ThermalYTransposed;
+    CoefficientTable ThermalZTransposed;
+    CoefficientTable VelocityXTransposed;
+    CoefficientTable VelocityYTransposed;
+    CoefficientTable VelocityZTransposed;
+    CoefficientTable VelocityXZTransposed;
+    CoefficientTable VelocityYZTransposed;
+
     std::vector<Limit> AberrationLimitZTable;
     std::vector<Limit> AccelerationLimitXTable;
     std::vector<Limit> AccelerationLimitYTable;
@@ -143,6 +179,12 @@ public:
     ForceComponentSettings VelocityComponentSettings;
     ForceComponentSettings FinalComponentSettings;
 
+    ForceLookupSettings ElevationLookupSettings;
+    ForceLookupSettings AzimuthLookupSettings;
+
+    ForceLookupGrid ElevationLookup;
+    ForceLookupGrid AzimuthLookup;
+
     /**
      * Tolerances for actuators being tested.
      */
@@ -156,6 +198,8 @@ public:
 private:
     void _loadNearNeighborZTable(const std::string &filename);
     void _loadNeighborsTable(const std::string &filename);
+    void _buildLookup(const char *name, const ForceLookupSettings &settings, ForceLookupGrid &grid,
+                      const ForceLookupGrid::Evaluator &evaluate);
 };
 
 }  // namespace SS
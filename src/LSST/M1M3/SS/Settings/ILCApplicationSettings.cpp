@@ -54,6 +54,9 @@ void ILCApplicationSettings::load(const std::string &filename) {
         ReportDCAStatus = timings["ReportDCAStatus"].as<uint32_t>();
         ReportDCAPressure = timings["ReportDCAPressure"].as<uint32_t>();
         ReportLVDT = timings["ReportLVDT"].as<uint32_t>();
+
+        StatusPollSlotTime = doc["StatusPollSlotTime"].as<uint32_t>();
+        ModbusBaudRate = doc["ModbusBaudRate"].as<uint32_t>();
     } catch (YAML::Exception &ex) {
         throw std::runtime_error(fmt::format("YAML Loading {}: {}", filename, ex.what()));
     }
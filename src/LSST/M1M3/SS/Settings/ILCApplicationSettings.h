@@ -55,6 +55,19 @@ struct ILCApplicationSettings {
     uint32_t ReportDCAPressure;
     uint32_t ReportLVDT;
 
+    /**
+     * Wire time (microseconds) available to each subnet in the active and
+     * raised bus lists. Time left after the fixed traffic is filled with
+     * status requests (see StatusPollList).
+     */
+    uint32_t StatusPollSlotTime;
+
+    /**
+     * Modbus bus speed (bits per second). Used to predict subnet wire time
+     * (see ModbusWireTime).
+     */
+    uint32_t ModbusBaudRate;
+
     void load(const std::string &filename);
 };
 
@@ -0,0 +1,69 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef OUTERLOOPAPPLICATIONSETTINGS_H_
+#define OUTERLOOPAPPLICATIONSETTINGS_H_
+
+#include <DataTypes.h>
+#include <string>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Settings of the outer (50 Hz) control loop.
+ */
+struct OuterLoopApplicationSettings {
+    /**
+     * When true, FPGA telemetry is pulled and processed, and the previous
+     * loop ILC data are published while the Modbus transaction is in flight.
+     * Only ILC response parsing waits for the Modbus IRQs. When false, a
+     * fixed 1 ms sleep follows the Modbus trigger and data are published at
+     * the end of the loop.
+     */
+    bool PipelinedLoop;
+
+    /**
+     * Number of consecutive outer loop clock ticks arriving late (previous
+     * loop overran its period) which triggers the OuterLoopDeadlineMiss
+     * fault. 0 disables the fault.
+     */
+    uint32_t DeadlineMissFaultThreshold;
+
+    /**
+     * When true, each subnet response is read and parsed as soon as the
+     * subnet Modbus IRQ is raised, so parsing of the subnets which finished
+     * overlaps transmission on the others. When false, all subnet IRQs are
+     * waited for before responses are read.
+     */
+    bool StreamedSubnetReadout;
+
+    void load(const std::string &filename);
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* OUTERLOOPAPPLICATIONSETTINGS_H_ */
@@ -0,0 +1,62 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <RealTimeApplicationSettings.h>
+#include <yaml-cpp/yaml.h>
+#include <spdlog/spdlog.h>
+
+#include <sched.h>
+
+using namespace LSST::M1M3::SS;
+
+void RealTimeApplicationSettings::load(const std::string &filename) {
+    try {
+        YAML::Node doc = YAML::LoadFile(filename);
+
+        Enabled = doc["Enabled"].as<bool>();
+        LockMemory = doc["LockMemory"].as<bool>();
+        StackPrefault = doc["StackPrefault"].as<size_t>();
+
+        Threads.clear();
+        for (auto thread : doc["Threads"]) {
+            auto name = thread.first.as<std::string>();
+            auto policy = thread.second["Policy"].as<std::string>();
+            ThreadRealTimeSettings threadSettings;
+            if (policy == "FIFO") {
+                threadSettings.Policy = SCHED_FIFO;
+            } else if (policy == "RR") {
+                threadSettings.Policy = SCHED_RR;
+            } else if (policy == "Other") {
+                threadSettings.Policy = SCHED_OTHER;
+            } else {
+                throw std::runtime_error(
+                        fmt::format("YAML Loading {}: unknown {} thread policy {}", filename, name, policy));
+            }
+            threadSettings.Priority = thread.second["Priority"].as<int>();
+            threadSettings.CPUs = thread.second["CPUs"].as<std::vector<int>>();
+            Threads[name] = threadSettings;
+        }
+    } catch (YAML::Exception &ex) {
+        throw std::runtime_error(fmt::format("YAML Loading {}: {}", filename, ex.what()));
+    }
+}
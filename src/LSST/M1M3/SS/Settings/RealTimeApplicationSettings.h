@@ -0,0 +1,67 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef REALTIMEAPPLICATIONSETTINGS_H_
+#define REALTIMEAPPLICATIONSETTINGS_H_
+
+#include <DataTypes.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Scheduling of a single thread.
+ */
+struct ThreadRealTimeSettings {
+    /// scheduling policy (SCHED_FIFO, SCHED_RR or SCHED_OTHER)
+    int Policy;
+    /// scheduling priority
+    int Priority;
+    /// CPUs the thread can run on, empty for all CPUs
+    std::vector<int> CPUs;
+};
+
+/**
+ * Real-time configuration of the controller threads - scheduling policies,
+ * priorities, CPU affinities and memory locking.
+ *
+ * @see RealTime
+ */
+struct RealTimeApplicationSettings {
+    bool Enabled;
+    bool LockMemory;
+    size_t StackPrefault;
+    std::map<std::string, ThreadRealTimeSettings> Threads;
+
+    void load(const std::string &filename);
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* REALTIMEAPPLICATIONSETTINGS_H_ */
@@ -196,6 +196,18 @@ InclinometerSettings* SettingReader::loadInclinometerSettings() {
     return &_inclinometerSettings;
 }
 
+OuterLoopApplicationSettings* SettingReader::loadOuterLoopApplicationSettings() {
+    SPDLOG_DEBUG("SettingReader: loadOuterLoopApplicationSettings()");
+    _outerLoopApplicationSettings.load(_getBasePath("OuterLoopApplicationSettings.yaml"));
+    return &_outerLoopApplicationSettings;
+}
+
+RealTimeApplicationSettings* SettingReader::loadRealTimeApplicationSettings() {
+    SPDLOG_DEBUG("SettingReader: loadRealTimeApplicationSettings()");
+    _realTimeApplicationSettings.load(_getBasePath("RealTimeApplicationSettings.yaml"));
+    return &_realTimeApplicationSettings;
+}
+
 std::string SettingReader::_getBasePath(std::string file) { return _rootPath + "/Base/" + file; }
 
 std::string SettingReader::_getSetPath(std::string file) {
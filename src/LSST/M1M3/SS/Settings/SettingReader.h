@@ -45,6 +45,8 @@
 #include <ExpansionFPGAApplicationSettings.h>
 #include <PIDSettings.h>
 #include <InclinometerSettings.h>
+#include <OuterLoopApplicationSettings.h>
+#include <RealTimeApplicationSettings.h>
 
 namespace LSST {
 namespace M1M3 {
@@ -107,6 +109,9 @@ public:
     ExpansionFPGAApplicationSettings* loadExpansionFPGAApplicationSettings();
     PIDSettings* loadPIDSettings();
     InclinometerSettings* loadInclinometerSettings();
+    OuterLoopApplicationSettings* loadOuterLoopApplicationSettings();
+    OuterLoopApplicationSettings* getOuterLoopApplicationSettings() { return &_outerLoopApplicationSettings; }
+    RealTimeApplicationSettings* loadRealTimeApplicationSettings();
 
 private:
     SettingReader& operator=(const SettingReader&) = delete;
@@ -131,6 +136,8 @@ private:
     ExpansionFPGAApplicationSettings _expansionFPGAApplicationSettings;
     PIDSettings _pidSettings;
     InclinometerSettings _inclinometerSettings;
+    OuterLoopApplicationSettings _outerLoopApplicationSettings;
+    RealTimeApplicationSettings _realTimeApplicationSettings;
 
     std::string _rootPath;
     std::string _currentSet;
@@ -60,8 +60,7 @@ States::Type DisabledState::update(UpdateCommand* command) {
     Model::get().getGyro()->processData();
     Model::get().getInclinometer()->processData();
     Model::get().getPowerController()->processData();
-    ilc->waitForAllSubnets(5000);
-    ilc->readAll();
+    ilc->waitAndReadAll(5000);
     ilc->calculateHPPostion();
     ilc->calculateHPMirrorForces();
     ilc->calculateFAMirrorForces();
@@ -80,8 +79,7 @@ States::Type DisabledState::enable(EnableCommand* command) {
     SPDLOG_INFO("DisabledState: enable()");
     Model::get().getILC()->writeSetModeEnableBuffer();
     Model::get().getILC()->triggerModbus();
-    Model::get().getILC()->waitForAllSubnets(5000);
-    Model::get().getILC()->readAll();
+    Model::get().getILC()->waitAndReadAll(5000);
     Model::get().getILC()->verifyResponses();
     Model::get().getDigitalInputOutput()->turnAirOn();
     Model::get().getPowerController()->setAllAuxPowerNetworks(true);
@@ -92,8 +90,7 @@ States::Type DisabledState::standby(StandbyCommand* command) {
     SPDLOG_INFO("DisabledState: standby()");
     Model::get().getILC()->writeSetModeStandbyBuffer();
     Model::get().getILC()->triggerModbus();
-    Model::get().getILC()->waitForAllSubnets(5000);
-    Model::get().getILC()->readAll();
+    Model::get().getILC()->waitAndReadAll(5000);
     Model::get().getILC()->verifyResponses();
     M1M3SSPublisher::get().tryLogForceActuatorState();
     Model::get().getPowerController()->setBothPowerNetworks(false);
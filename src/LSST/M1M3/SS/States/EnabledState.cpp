@@ -38,6 +38,8 @@
 #include <M1M3SSPublisher.h>
 #include <ModelPublisher.h>
 #include <Gyro.h>
+#include <StageProfiler.h>
+#include <SettingReader.h>
 #include <spdlog/spdlog.h>
 #include <FPGA.h>
 #include <SAL_MTM1M3C.h>
@@ -49,7 +51,13 @@ namespace LSST {
 namespace M1M3 {
 namespace SS {
 
-EnabledState::EnabledState(std::string name) : State(name) {}
+/**
+ * Per-stage timing of runLoop. Statistics are calculated from the last minute
+ * (at 50 Hz) of loops and reported every minute.
+ */
+static StageProfiler runLoopProfiler("runLoop", 3000, 3000);
+
+EnabledState::EnabledState(std::string name) : State(name) { _ilcDataPending = false; }
 
 States::Type EnabledState::storeTMAAzimuthSample(TMAAzimuthSampleCommand* command) {
     SPDLOG_TRACE("EnabledState: storeTMAAzimuthSample()");
@@ -74,36 +82,96 @@ States::Type EnabledState::setAirSlewFlag(SetAirSlewFlagCommand* command) {
     return Model::get().getSafetyController()->checkSafety(States::NoStateTransition);
 }
 
+void EnabledState::leaveState() {
+    if (_ilcDataPending) {
+        _publishILCData(Model::get().getILC(), false);
+    }
+}
+
 void EnabledState::runLoop() {
     SPDLOG_TRACE("EnabledState: runLoop()");
     ILC* ilc = Model::get().getILC();
+    runLoopProfiler.start();
     Model::get().getForceController()->updateAppliedForces();
+    runLoopProfiler.mark("updateAppliedForces");
     Model::get().getForceController()->processAppliedForces();
+    runLoopProfiler.mark("processAppliedForces");
     ilc->writeControlListBuffer();
+    runLoopProfiler.mark("writeControlListBuffer");
     ilc->triggerModbus();
+    runLoopProfiler.mark("triggerModbus");
     Model::get().getDigitalInputOutput()->tryToggleHeartbeat();
-    std::this_thread::sleep_for(1ms);
+    runLoopProfiler.mark("tryToggleHeartbeat");
+    bool pipelined = SettingReader::instance().getOuterLoopApplicationSettings()->PipelinedLoop;
+    if (pipelined == false) {
+        std::this_thread::sleep_for(1ms);
+        runLoopProfiler.mark("sleep");
+    }
     IFPGA::get().pullTelemetry();
+    runLoopProfiler.mark("pullTelemetry");
     Model::get().getAccelerometer()->processData();
+    runLoopProfiler.mark("Accelerometer processData");
     Model::get().getDigitalInputOutput()->processData();
+    runLoopProfiler.mark("DigitalInputOutput processData");
     Model::get().getDisplacement()->processData();
+    runLoopProfiler.mark("Displacement processData");
     Model::get().getGyro()->processData();
+    runLoopProfiler.mark("Gyro processData");
     Model::get().getInclinometer()->processData();
+    runLoopProfiler.mark("Inclinometer processData");
     Model::get().getPowerController()->processData();
-    ilc->waitForAllSubnets(5000);
-    ilc->readAll();
+    runLoopProfiler.mark("PowerController processData");
+    // publish previous loop data while Modbus transaction is in flight
+    if (pipelined && _ilcDataPending) {
+        _publishILCData(ilc, true);
+    }
+    if (SettingReader::instance().getOuterLoopApplicationSettings()->StreamedSubnetReadout) {
+        ilc->waitAndReadAll(5000);
+        runLoopProfiler.mark("waitAndReadAll");
+    } else {
+        ilc->waitForAllSubnets(5000);
+        runLoopProfiler.mark("waitForAllSubnets");
+        ilc->readAll();
+        runLoopProfiler.mark("readAll");
+    }
     ilc->calculateHPPostion();
+    runLoopProfiler.mark("calculateHPPostion");
     ilc->calculateHPMirrorForces();
+    runLoopProfiler.mark("calculateHPMirrorForces");
     ilc->calculateFAMirrorForces();
+    runLoopProfiler.mark("calculateFAMirrorForces");
     ilc->verifyResponses();
+    runLoopProfiler.mark("verifyResponses");
+    _ilcDataPending = true;
+    if (pipelined == false) {
+        _publishILCData(ilc, true);
+    }
+    runLoopProfiler.end();
+}
+
+void EnabledState::_publishILCData(ILC* ilc, bool profile) {
+    auto mark = [profile](const char* stage) {
+        if (profile) {
+            runLoopProfiler.mark(stage);
+        }
+    };
     ilc->publishForceActuatorStatus();
+    mark("publishForceActuatorStatus");
     ilc->publishForceActuatorData();
+    mark("publishForceActuatorData");
     ilc->publishHardpointStatus();
+    mark("publishHardpointStatus");
     ilc->publishHardpointData();
+    mark("publishHardpointData");
     ilc->publishHardpointMonitorStatus();
+    mark("publishHardpointMonitorStatus");
     ilc->publishHardpointMonitorData();
+    mark("publishHardpointMonitorData");
     M1M3SSPublisher::get().tryLogHardpointActuatorWarning();
+    mark("tryLogHardpointActuatorWarning");
     M1M3SSPublisher::get().getEnabledForceActuators()->log();
+    mark("logEnabledForceActuators");
+    _ilcDataPending = false;
 }
 
 void EnabledState::sendTelemetry() {
@@ -134,8 +202,7 @@ bool EnabledState::lowerCompleted() {
 States::Type EnabledState::disableMirror() {
     Model::get().getILC()->writeSetModeDisableBuffer();
     Model::get().getILC()->triggerModbus();
-    Model::get().getILC()->waitForAllSubnets(5000);
-    Model::get().getILC()->readAll();
+    Model::get().getILC()->waitAndReadAll(5000);
     Model::get().getILC()->verifyResponses();
     Model::get().getForceController()->reset();
     Model::get().getDigitalInputOutput()->turnAirOff();
@@ -30,6 +30,8 @@ namespace LSST {
 namespace M1M3 {
 namespace SS {
 
+class ILC;
+
 /**
  * Parent class for all enabled sub-states. Enabled state is defined in SAL,
  * this class provides basic functionality for it. Subclasses needs to
@@ -43,6 +45,12 @@ public:
     States::Type storeTMAElevationSample(TMAElevationSampleCommand* command) override;
     States::Type setAirSlewFlag(SetAirSlewFlagCommand* command) override;
 
+    /**
+     * Publishes ILC data read in the last pipelined loop, so they aren't
+     * left for the next entry into this state.
+     */
+    void leaveState() override;
+
 protected:
     /**
      * Actions to be performed during a loop in enabled sub-state. Calculate
@@ -70,6 +78,21 @@ protected:
     bool lowerCompleted();
 
     States::Type disableMirror();
+
+private:
+    /**
+     * Publish ILC data (force actuators, hardpoints and hardpoint monitors
+     * status and data) and log hardpoint warnings and enabled force
+     * actuators. In pipelined mode called during the next loop, while the
+     * Modbus transaction is in flight.
+     *
+     * @param ilc ILC with data to publish
+     * @param profile true to record publish stages in the runLoop profiler
+     */
+    void _publishILCData(ILC* ilc, bool profile);
+
+    /// true if ILC data read in the previous pipelined loop weren't yet published
+    bool _ilcDataPending;
 };
 
 } /* namespace SS */
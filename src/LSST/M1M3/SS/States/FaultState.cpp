@@ -62,8 +62,7 @@ States::Type FaultState::update(UpdateCommand* command) {
     Model::get().getGyro()->processData();
     Model::get().getInclinometer()->processData();
     Model::get().getPowerController()->processData();
-    ilc->waitForAllSubnets(5000);
-    ilc->readAll();
+    ilc->waitAndReadAll(5000);
     ilc->calculateHPPostion();
     ilc->calculateHPMirrorForces();
     ilc->calculateFAMirrorForces();
@@ -81,8 +80,7 @@ States::Type FaultState::standby(StandbyCommand* command) {
     SPDLOG_TRACE("FaultState: standby()");
     Model::get().getILC()->writeSetModeStandbyBuffer();
     Model::get().getILC()->triggerModbus();
-    Model::get().getILC()->waitForAllSubnets(5000);
-    Model::get().getILC()->readAll();
+    Model::get().getILC()->waitAndReadAll(5000);
     Model::get().getILC()->verifyResponses();
     Model::get().getPowerController()->setAllPowerNetworks(false);
     Model::get().getForceController()->zeroSupportPercentage();
@@ -71,48 +71,39 @@ States::Type StandbyState::start(StartCommand* command) {
     ilc->flushAll();
     ilc->writeSetModeClearFaultsBuffer();
     ilc->triggerModbus();
-    ilc->waitForAllSubnets(5000);
-    ilc->readAll();
+    ilc->waitAndReadAll(5000);
     digitalInputOutput->tryToggleHeartbeat();
     ilc->writeReportServerIDBuffer();
     ilc->triggerModbus();
-    ilc->waitForAllSubnets(5000);
-    ilc->readAll();
+    ilc->waitAndReadAll(5000);
     digitalInputOutput->tryToggleHeartbeat();
     ilc->writeReportServerStatusBuffer();
     ilc->triggerModbus();
-    ilc->waitForAllSubnets(5000);
-    ilc->readAll();
+    ilc->waitAndReadAll(5000);
     digitalInputOutput->tryToggleHeartbeat();
     ilc->writeReportADCScanRateBuffer();
     ilc->triggerModbus();
-    ilc->waitForAllSubnets(5000);
-    ilc->readAll();
+    ilc->waitAndReadAll(5000);
     digitalInputOutput->tryToggleHeartbeat();
     ilc->writeReadCalibrationDataBuffer();
     ilc->triggerModbus();
-    ilc->waitForAllSubnets(5000);
-    ilc->readAll();
+    ilc->waitAndReadAll(5000);
     digitalInputOutput->tryToggleHeartbeat();
     ilc->writeReadBoostValveDCAGainBuffer();
     ilc->triggerModbus();
-    ilc->waitForAllSubnets(5000);
-    ilc->readAll();
+    ilc->waitAndReadAll(5000);
     digitalInputOutput->tryToggleHeartbeat();
     ilc->writeReportDCAIDBuffer();
     ilc->triggerModbus();
-    ilc->waitForAllSubnets(5000);
-    ilc->readAll();
+    ilc->waitAndReadAll(5000);
     digitalInputOutput->tryToggleHeartbeat();
     ilc->writeReportDCAStatusBuffer();
     ilc->triggerModbus();
-    ilc->waitForAllSubnets(5000);
-    ilc->readAll();
+    ilc->waitAndReadAll(5000);
     digitalInputOutput->tryToggleHeartbeat();
     ilc->writeSetModeDisableBuffer();
     ilc->triggerModbus();
-    ilc->waitForAllSubnets(5000);
-    ilc->readAll();
+    ilc->waitAndReadAll(5000);
     digitalInputOutput->tryToggleHeartbeat();
     M1M3SSPublisher::getEnabledForceActuators()->log();
     M1M3SSPublisher::get().tryLogForceActuatorState();
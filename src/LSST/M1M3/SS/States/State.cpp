@@ -161,6 +161,8 @@ States::Type State::enableAllForceActuators(EnableAllForceActuatorsCommand* comm
     return rejectCommandInvalidState(command, "EnableAllForceActuators");
 }
 
+void State::leaveState() {}
+
 States::Type State::rejectCommandInvalidState(Command* command, std::string cmd_name) {
     std::string reason = "The command " + cmd_name + " is not valid in the " + this->name + ".";
     SPDLOG_WARN(reason);
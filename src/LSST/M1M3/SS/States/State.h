@@ -151,6 +151,11 @@ public:
     virtual States::Type enableForceActuator(EnableForceActuatorCommand* command);
     virtual States::Type enableAllForceActuators(EnableAllForceActuatorsCommand* command);
 
+    /**
+     * Called when the state is left, before the new state becomes current.
+     */
+    virtual void leaveState();
+
 protected:
     std::string name;
 
@@ -26,6 +26,9 @@
 #include <thread>
 #include <spdlog/spdlog.h>
 
+#include <errno.h>
+#include <string.h>
+
 using namespace std::chrono_literals;
 
 namespace LSST {
@@ -34,9 +37,13 @@ namespace SS {
 
 ControllerThread::ControllerThread() : _keepRunning(true) {
     SPDLOG_DEBUG("ControllerThread: ControllerThread()");
+    sem_init(&_semaphore, 0, 0);
 }
 
-ControllerThread::~ControllerThread() { _clear(); }
+ControllerThread::~ControllerThread() {
+    _clear();
+    sem_destroy(&_semaphore);
+}
 
 ControllerThread& ControllerThread::get() {
     static ControllerThread controllerThread;
@@ -46,11 +53,14 @@ ControllerThread& ControllerThread::get() {
 void ControllerThread::run() {
     SPDLOG_INFO("ControllerThread: Start");
     while (_keepRunning) {
-        std::unique_lock<std::mutex> lock(_mutex);
-        _cv.wait(lock, [this] { return (_queue.empty() == false) || (_keepRunning == false); });
-        while (!_queue.empty()) {
-            Command* command = _queue.front();
-            _queue.pop();
+        if (sem_wait(&_semaphore) != 0) {
+            if (errno != EINTR) {
+                SPDLOG_ERROR("ControllerThread: cannot wait for command: {}", strerror(errno));
+            }
+            continue;
+        }
+        Command* command;
+        if (_updateQueue.pop(command) || _commandQueue.pop(command)) {
             _execute(command);
         }
     }
@@ -58,32 +68,40 @@ void ControllerThread::run() {
 }
 
 void ControllerThread::stop() {
-    {
-        std::lock_guard<std::mutex> lg(_mutex);
-        _keepRunning = false;
-    }
-    _cv.notify_one();
+    _keepRunning = false;
+    sem_post(&_semaphore);
 }
 
 void ControllerThread::_clear() {
     SPDLOG_TRACE("ControllerThread: _clear()");
-    {
-        std::lock_guard<std::mutex> lg(_mutex);
-        while (!_queue.empty()) {
-            Command* command = _queue.front();
-            delete command;
-        }
-        std::queue<Command*>().swap(_queue);
+    Command* command;
+    while (_updateQueue.pop(command)) {
+        delete command;
+    }
+    while (_commandQueue.pop(command)) {
+        delete command;
     }
 }
 
 void ControllerThread::enqueue(Command* command) {
     SPDLOG_TRACE("ControllerThread: enqueue()");
-    {
-        std::lock_guard<std::mutex> lg(_mutex);
-        _queue.push(command);
+    if (_commandQueue.push(command) == false) {
+        SPDLOG_WARN("ControllerThread: command queue full, rejecting command");
+        command->ackFailed("Command queue full");
+        delete command;
+        return;
+    }
+    sem_post(&_semaphore);
+}
+
+void ControllerThread::enqueueUpdate(Command* command) {
+    SPDLOG_TRACE("ControllerThread: enqueueUpdate()");
+    if (_updateQueue.push(command) == false) {
+        SPDLOG_WARN("ControllerThread: update queue full, dropping update");
+        delete command;
+        return;
     }
-    _cv.notify_one();
+    sem_post(&_semaphore);
 }
 
 void ControllerThread::_execute(Command* command) {
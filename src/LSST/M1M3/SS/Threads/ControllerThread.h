@@ -25,10 +25,11 @@
 #define CONTROLLERTHREAD_H_
 
 #include <Command.h>
+#include <LockFreeQueue.h>
 
-#include <condition_variable>
-#include <mutex>
-#include <queue>
+#include <atomic>
+
+#include <semaphore.h>
 
 namespace LSST {
 namespace M1M3 {
@@ -42,6 +43,12 @@ namespace SS {
  * to the Controller::execute method. Singleton, as only a single instance
  * should occur in an application. Runs in a single thread - provides guarantee
  * that only single command is being executed in any moment.
+ *
+ * Commands are stored in two bounded lock-free queues. UpdateCommands, issued
+ * by the outer loop clock, have their own priority queue, so the periodic
+ * update is never delayed behind SAL commands. The semaphore counts commands
+ * in both queues, so the controller thread sleeps when there is nothing to
+ * do. Neither enqueuing nor dequeuing takes a lock.
  */
 class ControllerThread {
 public:
@@ -60,9 +67,23 @@ public:
 
     /**
      * @brief Put command into queue.
+     *
+     * If the queue is full, command is acknowledged as failed and deleted.
+     *
+     * @param command command to execute
      */
     void enqueue(Command* command);
 
+    /**
+     * @brief Put periodic update command into priority queue.
+     *
+     * Update commands are executed before any command waiting in the command
+     * queue. If the priority queue is full, the update is dropped.
+     *
+     * @param command update command
+     */
+    void enqueueUpdate(Command* command);
+
 private:
     ControllerThread& operator=(const ControllerThread&) = delete;
     ControllerThread(const ControllerThread&) = delete;
@@ -70,10 +91,10 @@ private:
     void _clear();
     void _execute(Command* command);
 
-    bool _keepRunning;
-    std::mutex _mutex;
-    std::queue<Command*> _queue;
-    std::condition_variable _cv;
+    std::atomic<bool> _keepRunning;
+    LockFreeQueue<Command*, 4> _updateQueue;
+    LockFreeQueue<Command*, 256> _commandQueue;
+    sem_t _semaphore;
 };
 
 } /* namespace SS */
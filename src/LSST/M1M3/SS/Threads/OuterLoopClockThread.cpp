@@ -30,6 +30,7 @@
 #include <M1M3SSPublisher.h>
 #include <Timestamp.h>
 #include <NiError.h>
+#include <OuterLoopMonitor.h>
 
 #include <spdlog/spdlog.h>
 
@@ -44,12 +45,13 @@ void OuterLoopClockThread::run() {
     while (_keepRunning) {
         try {
             IFPGA::get().waitForOuterLoopClock(1000);
+            OuterLoopMonitor::get().tick();
         } catch (NiError& er) {
             SPDLOG_WARN("OuterLoopClockThread: Failed to receive outer loop clock");
         }
 
         if (_keepRunning) {
-            ControllerThread::get().enqueue(new UpdateCommand(&_updateMutex));
+            ControllerThread::get().enqueueUpdate(new UpdateCommand(&_updateMutex));
         }
         _updateMutex.lock();
         _updateMutex.unlock();
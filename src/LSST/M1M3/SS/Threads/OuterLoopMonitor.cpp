@@ -0,0 +1,106 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <OuterLoopMonitor.h>
+#include <LimitLog.h>
+#include <Model.h>
+#include <SafetyController.h>
+#include <SettingReader.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+using namespace std::chrono_literals;
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+OuterLoopMonitor::OuterLoopMonitor(std::chrono::microseconds period, std::chrono::microseconds jitterTolerance,
+                                   uint32_t reportInterval)
+        : _period(period),
+          _jitterTolerance(jitterTolerance),
+          _reportInterval(reportInterval),
+          _profiler("outerLoopClock", reportInterval, 0) {
+    _lastInterval = std::chrono::nanoseconds::zero();
+    _ticks = 0;
+    _missedTicks = 0;
+    _consecutiveMisses = 0;
+    _updates = 0;
+}
+
+OuterLoopMonitor& OuterLoopMonitor::get() {
+    static OuterLoopMonitor monitor(20ms, 1ms, 3000);
+    return monitor;
+}
+
+void OuterLoopMonitor::tick(std::chrono::steady_clock::time_point now) {
+    if (_ticks > 0) {
+        _lastInterval = now - _lastTick;
+        if (_lastInterval > _period + _jitterTolerance) {
+            // previous update overran; count every whole period skipped, at least one
+            int64_t missed = std::max<int64_t>(1, _lastInterval / _period - 1);
+            _missedTicks += missed;
+            _consecutiveMisses++;
+            TG_LOG_WARN(60s, "Outer loop missed {} deadline(s), interval {:.3f} ms, {} missed in total",
+                        missed, std::chrono::duration<double, std::milli>(_lastInterval).count(),
+                        _missedTicks);
+        } else {
+            _consecutiveMisses = 0;
+        }
+    }
+    _lastTick = now;
+    _ticks++;
+}
+
+void OuterLoopMonitor::updateStarted(std::chrono::steady_clock::time_point now) {
+    if (_ticks == 0) {
+        return;
+    }
+
+    if (_lastInterval > std::chrono::nanoseconds::zero()) {
+        _profiler.addSample("interval", _lastInterval);
+    }
+    _profiler.addSample("tick to update", now - _lastTick);
+
+    _updates++;
+    if (_reportInterval > 0 && _updates >= _reportInterval) {
+        _profiler.requestReport();
+        SPDLOG_DEBUG("outerLoopClock {} ticks, {} missed", _ticks, _missedTicks);
+        _updates = 0;
+    }
+
+    // settings are loaded before safety controller is created
+    SafetyController* safetyController = Model::get().getSafetyController();
+    if (safetyController != NULL && _consecutiveMisses > 0) {
+        uint32_t threshold =
+                SettingReader::instance().getOuterLoopApplicationSettings()->DeadlineMissFaultThreshold;
+        safetyController->outerLoopDeadlineMiss(threshold > 0 && _consecutiveMisses >= threshold,
+                                                _consecutiveMisses);
+    }
+}
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
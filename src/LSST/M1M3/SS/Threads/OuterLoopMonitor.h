@@ -0,0 +1,130 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef OUTERLOOPMONITOR_H_
+#define OUTERLOOPMONITOR_H_
+
+#include <StageProfiler.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Monitors outer loop clock jitter and deadline misses. OuterLoopClockThread
+ * calls tick() when outer loop clock IRQ is received, UpdateCommand calls
+ * updateStarted() when the update starts to execute. Interval between clock
+ * ticks and latency between clock tick and update start are kept in
+ * StageProfiler and periodically logged.
+ *
+ * Tick arriving later than period plus jitter tolerance after the previous
+ * tick means the previous update overran its deadline - the clock IRQ stayed
+ * latched until the update finished. Each whole period elapsed beyond the
+ * first counts as a skipped tick, an overrun shorter than that counts as one
+ * miss. If OuterLoopApplicationSettings::DeadlineMissFaultThreshold
+ * consecutive ticks arrive late, SafetyController is notified.
+ *
+ * Both methods are called sequentially - OuterLoopClockThread waits for
+ * update to finish before waiting for the next tick.
+ */
+class OuterLoopMonitor {
+public:
+    /**
+     * Construct monitor.
+     *
+     * @param period expected outer loop period
+     * @param jitterTolerance allowed clock tick interval jitter, longer
+     * intervals are deadline misses
+     * @param reportInterval number of updates between statistics reports
+     */
+    OuterLoopMonitor(std::chrono::microseconds period, std::chrono::microseconds jitterTolerance,
+                     uint32_t reportInterval);
+
+    /**
+     * Returns singleton instance, with 20 ms (50 Hz) period, 1 ms jitter
+     * tolerance and report
+     * every minute.
+     *
+     * @return monitor instance
+     */
+    static OuterLoopMonitor& get();
+
+    /**
+     * Records outer loop clock tick. Called from OuterLoopClockThread.
+     */
+    void tick() { tick(std::chrono::steady_clock::now()); }
+
+    /**
+     * Records outer loop clock tick received at given time.
+     *
+     * @param now tick time
+     */
+    void tick(std::chrono::steady_clock::time_point now);
+
+    /**
+     * Records update start. Called from controller thread.
+     */
+    void updateStarted() { updateStarted(std::chrono::steady_clock::now()); }
+
+    /**
+     * Records update started at given time.
+     *
+     * @param now update start time
+     */
+    void updateStarted(std::chrono::steady_clock::time_point now);
+
+    uint64_t getTicks() { return _ticks; }
+    uint64_t getMissedTicks() { return _missedTicks; }
+    uint32_t getConsecutiveMisses() { return _consecutiveMisses; }
+
+    /**
+     * Returns profiler with "interval" and "tick to update" statistics.
+     *
+     * @return interval and latency profiler
+     */
+    StageProfiler& getProfiler() { return _profiler; }
+
+private:
+    std::chrono::microseconds _period;
+    std::chrono::microseconds _jitterTolerance;
+    uint32_t _reportInterval;
+
+    StageProfiler _profiler;
+
+    std::chrono::steady_clock::time_point _lastTick;
+    std::chrono::nanoseconds _lastInterval;
+
+    uint64_t _ticks;
+    uint64_t _missedTicks;
+    uint32_t _consecutiveMisses;
+    uint32_t _updates;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* OUTERLOOPMONITOR_H_ */
@@ -0,0 +1,48 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <PollingBackoff.h>
+
+#include <algorithm>
+#include <thread>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+PollingBackoff::PollingBackoff(std::chrono::microseconds minInterval, std::chrono::microseconds maxInterval)
+        : _minInterval(minInterval), _maxInterval(maxInterval), _interval(minInterval) {}
+
+void PollingBackoff::sleep() { std::this_thread::sleep_for(_interval); }
+
+void PollingBackoff::processed(bool dataReceived) {
+    if (dataReceived) {
+        _interval = _minInterval;
+    } else {
+        _interval = std::min(_interval * 2, _maxInterval);
+    }
+}
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
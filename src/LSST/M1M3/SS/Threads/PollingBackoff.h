@@ -0,0 +1,73 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef POLLINGBACKOFF_H_
+#define POLLINGBACKOFF_H_
+
+#include <chrono>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Sleep between polls of SAL topics. Sleep time is doubled after each poll
+ * without data (up to maximal interval) and reset to minimal interval once
+ * data are received. Keeps command latency low during activity, while not
+ * burning CPU when idle.
+ */
+class PollingBackoff {
+public:
+    /**
+     * Construct polling back-off.
+     *
+     * @param minInterval sleep time after data were received
+     * @param maxInterval maximal sleep time when idle
+     */
+    PollingBackoff(std::chrono::microseconds minInterval, std::chrono::microseconds maxInterval);
+
+    /**
+     * Sleeps for the current interval.
+     */
+    void sleep();
+
+    /**
+     * Adjusts interval after topics were polled.
+     *
+     * @param dataReceived true if any topic returned data
+     */
+    void processed(bool dataReceived);
+
+    std::chrono::microseconds getInterval() { return _interval; }
+
+private:
+    std::chrono::microseconds _minInterval;
+    std::chrono::microseconds _maxInterval;
+    std::chrono::microseconds _interval;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* POLLINGBACKOFF_H_ */
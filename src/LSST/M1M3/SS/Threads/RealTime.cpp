@@ -0,0 +1,127 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <RealTime.h>
+
+#include <spdlog/spdlog.h>
+
+#include <alloca.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/mman.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+namespace RealTime {
+
+static const char* policyName(int policy) {
+    switch (policy) {
+        case SCHED_FIFO:
+            return "SCHED_FIFO";
+        case SCHED_RR:
+            return "SCHED_RR";
+        case SCHED_OTHER:
+            return "SCHED_OTHER";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * Touch stack pages, so the kernel maps them before the thread enters its
+ * real-time loop. Must not be inlined - the stack is released on return.
+ */
+static void __attribute__((noinline)) prefaultStack(size_t size) {
+    volatile uint8_t* stack = static_cast<volatile uint8_t*>(alloca(size));
+    for (size_t i = 0; i < size; i += 4096) {
+        stack[i] = 0;
+    }
+}
+
+void lockMemory(RealTimeApplicationSettings* settings) {
+    if (settings->Enabled == false) {
+        SPDLOG_INFO("RealTime: disabled, threads run with default scheduling");
+        return;
+    }
+    if (settings->LockMemory == false) {
+        SPDLOG_INFO("RealTime: memory locking disabled");
+        return;
+    }
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        SPDLOG_WARN("RealTime: cannot lock memory: {}", strerror(errno));
+        return;
+    }
+    SPDLOG_INFO("RealTime: memory locked");
+}
+
+void configureThread(const char* name, RealTimeApplicationSettings* settings) {
+    if (settings->Enabled == false) {
+        return;
+    }
+
+    auto it = settings->Threads.find(name);
+    if (it == settings->Threads.end()) {
+        SPDLOG_INFO("RealTime: {} thread - not configured, default scheduling", name);
+        return;
+    }
+    const ThreadRealTimeSettings& threadSettings = it->second;
+
+    struct sched_param param;
+    param.sched_priority = threadSettings.Priority;
+    int ret = pthread_setschedparam(pthread_self(), threadSettings.Policy, &param);
+    if (ret != 0) {
+        SPDLOG_WARN("RealTime: {} thread - cannot set {} priority {}: {}", name,
+                    policyName(threadSettings.Policy), threadSettings.Priority, strerror(ret));
+    } else {
+        SPDLOG_INFO("RealTime: {} thread - {} priority {}", name, policyName(threadSettings.Policy),
+                    threadSettings.Priority);
+    }
+
+    if (threadSettings.CPUs.empty() == false) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (auto cpu : threadSettings.CPUs) {
+            CPU_SET(cpu, &cpus);
+        }
+        ret = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+        if (ret != 0) {
+            SPDLOG_WARN("RealTime: {} thread - cannot set CPU affinity to {}: {}", name,
+                        fmt::join(threadSettings.CPUs, ","), strerror(ret));
+        } else {
+            SPDLOG_INFO("RealTime: {} thread - CPU affinity {}", name, fmt::join(threadSettings.CPUs, ","));
+        }
+    }
+
+    if (settings->StackPrefault > 0) {
+        prefaultStack(settings->StackPrefault);
+        SPDLOG_INFO("RealTime: {} thread - prefaulted {} bytes of stack", name, settings->StackPrefault);
+    }
+}
+
+}  // namespace RealTime
+}  // namespace SS
+}  // namespace M1M3
+}  // namespace LSST
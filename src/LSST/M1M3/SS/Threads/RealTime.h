@@ -0,0 +1,62 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef REALTIME_H_
+#define REALTIME_H_
+
+#include <RealTimeApplicationSettings.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Functions applying real-time configuration. Results (either success or
+ * failure) are logged, so the startup log contains report what was applied.
+ * Failures aren't fatal - the application runs with default scheduling.
+ */
+namespace RealTime {
+
+/**
+ * Locks process memory if enabled in settings.
+ *
+ * @param settings real-time settings
+ */
+void lockMemory(RealTimeApplicationSettings* settings);
+
+/**
+ * Configures calling thread scheduling policy, priority and CPU affinity,
+ * and prefaults its stack. Shall be called as the first thing in the thread.
+ *
+ * @param name thread name, key into RealTimeApplicationSettings::Threads
+ * @param settings real-time settings
+ */
+void configureThread(const char* name, RealTimeApplicationSettings* settings);
+
+}  // namespace RealTime
+
+}  // namespace SS
+}  // namespace M1M3
+}  // namespace LSST
+
+#endif /* REALTIME_H_ */
@@ -26,92 +26,106 @@
 #include <M1M3SSPublisher.h>
 #include <M1M3SSSubscriber.h>
 #include <chrono>
-#include <thread>
 #include <spdlog/spdlog.h>
 
+using namespace std::chrono_literals;
+
 namespace LSST {
 namespace M1M3 {
 namespace SS {
 
-SubscriberThread::SubscriberThread() { _keepRunning = true; }
+/**
+ * Functions accepting SAL commands and telemetry, polled in every loop.
+ */
+static Command* (M1M3SSSubscriber::*const topics[])() = {
+        &M1M3SSSubscriber::tryAcceptCommandSetLogLevel,
+        &M1M3SSSubscriber::tryAcceptCommandStart,
+        &M1M3SSSubscriber::tryAcceptCommandEnable,
+        &M1M3SSSubscriber::tryAcceptCommandDisable,
+        &M1M3SSSubscriber::tryAcceptCommandStandby,
+        &M1M3SSSubscriber::tryAcceptCommandExitControl,
+        &M1M3SSSubscriber::tryAcceptCommandPanic,
+        &M1M3SSSubscriber::tryAcceptCommandTurnAirOn,
+        &M1M3SSSubscriber::tryAcceptCommandTurnAirOff,
+        &M1M3SSSubscriber::tryAcceptCommandApplyOffsetForces,
+        &M1M3SSSubscriber::tryAcceptCommandClearOffsetForces,
+        &M1M3SSSubscriber::tryAcceptCommandRaiseM1M3,
+        &M1M3SSSubscriber::tryAcceptCommandLowerM1M3,
+        &M1M3SSSubscriber::tryAcceptCommandApplyActiveOpticForces,
+        &M1M3SSSubscriber::tryAcceptCommandClearActiveOpticForces,
+        &M1M3SSSubscriber::tryAcceptCommandEnterEngineering,
+        &M1M3SSSubscriber::tryAcceptCommandExitEngineering,
+        &M1M3SSSubscriber::tryAcceptCommandSetAirSlewFlag,
+        &M1M3SSSubscriber::tryAcceptCommandTestHardpoint,
+        &M1M3SSSubscriber::tryAcceptCommandMoveHardpointActuators,
+        &M1M3SSSubscriber::tryAcceptCommandEnableHardpointChase,
+        &M1M3SSSubscriber::tryAcceptCommandDisableHardpointChase,
+        &M1M3SSSubscriber::tryAcceptCommandAbortRaiseM1M3,
+        &M1M3SSSubscriber::tryAcceptCommandTranslateM1M3,
+        &M1M3SSSubscriber::tryAcceptCommandStopHardpointMotion,
+        &M1M3SSSubscriber::tryAcceptCommandPositionM1M3,
+        &M1M3SSSubscriber::tryAcceptCommandTurnLightsOn,
+        &M1M3SSSubscriber::tryAcceptCommandTurnLightsOff,
+        &M1M3SSSubscriber::tryAcceptCommandTurnPowerOn,
+        &M1M3SSSubscriber::tryAcceptCommandTurnPowerOff,
+        &M1M3SSSubscriber::tryAcceptCommandEnableHardpointCorrections,
+        &M1M3SSSubscriber::tryAcceptCommandDisableHardpointCorrections,
+        &M1M3SSSubscriber::tryAcceptCommandRunMirrorForceProfile,
+        &M1M3SSSubscriber::tryAcceptCommandAbortProfile,
+        &M1M3SSSubscriber::tryAcceptCommandApplyOffsetForcesByMirrorForce,
+        &M1M3SSSubscriber::tryAcceptCommandUpdatePID,
+        &M1M3SSSubscriber::tryAcceptCommandResetPID,
+        &M1M3SSSubscriber::tryAcceptCommandForceActuatorBumpTest,
+        &M1M3SSSubscriber::tryAcceptCommandKillForceActuatorBumpTest,
+        &M1M3SSSubscriber::tryAcceptCommandDisableForceActuator,
+        &M1M3SSSubscriber::tryAcceptCommandEnableForceActuator,
+        &M1M3SSSubscriber::tryAcceptCommandEnableAllForceActuators,
+        &M1M3SSSubscriber::tryGetSampleTMAAzimuth,
+        &M1M3SSSubscriber::tryGetSampleTMAElevation,
+};
+
+SubscriberThread::SubscriberThread() : _backoff(100us, 2ms) { _keepRunning = true; }
 
 void SubscriberThread::run() {
     SPDLOG_INFO("SubscriberThread: Start");
     std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
     while (_keepRunning) {
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandSetLogLevel());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandStart());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandEnable());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandDisable());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandStandby());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandExitControl());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandPanic());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandTurnAirOn());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandTurnAirOff());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandApplyOffsetForces());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandClearOffsetForces());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandRaiseM1M3());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandLowerM1M3());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandApplyActiveOpticForces());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandClearActiveOpticForces());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandEnterEngineering());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandExitEngineering());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandSetAirSlewFlag());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandTestHardpoint());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandMoveHardpointActuators());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandEnableHardpointChase());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandDisableHardpointChase());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandAbortRaiseM1M3());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandTranslateM1M3());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandStopHardpointMotion());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandPositionM1M3());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandTurnLightsOn());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandTurnLightsOff());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandTurnPowerOn());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandTurnPowerOff());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandEnableHardpointCorrections());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandDisableHardpointCorrections());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandRunMirrorForceProfile());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandAbortProfile());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandApplyOffsetForcesByMirrorForce());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandUpdatePID());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandResetPID());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandForceActuatorBumpTest());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandKillForceActuatorBumpTest());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandDisableForceActuator());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandEnableForceActuator());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryAcceptCommandEnableAllForceActuators());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryGetSampleTMAAzimuth());
-        _enqueueCommandIfAvailable(M1M3SSSubscriber::get().tryGetSampleTMAElevation());
+        bool dataReceived = false;
+        for (auto topic : topics) {
+            dataReceived |= _enqueueCommandIfAvailable((M1M3SSSubscriber::get().*topic)());
+        }
+        _backoff.processed(dataReceived);
         std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
         long executionTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
         if (executionTime > 100) {
             SPDLOG_WARN("SubscriberThread executing for too long: {} ms", executionTime);
         }
         begin = end;
-        std::this_thread::sleep_for(100us);
+        _backoff.sleep();
     }
     SPDLOG_INFO("SubscriberThread: Completed");
 }
 
 void SubscriberThread::stop() { _keepRunning = false; }
 
-void SubscriberThread::_enqueueCommandIfAvailable(Command* command) {
-    if (command) {
-        try {
-            if (command->validate()) {
-                ControllerThread::get().enqueue(command);
-            } else {
-                auto info = M1M3SSPublisher::get().getEventCommandRejectionWarning();
-                command->ackFailed(
-                        fmt::format("Command \"{}\" validation failed: {} ", info->command, info->reason));
-                delete command;
-            }
-        } catch (std::exception& ex) {
-            command->ackFailed(ex.what());
+bool SubscriberThread::_enqueueCommandIfAvailable(Command* command) {
+    if (command == nullptr) {
+        return false;
+    }
+    try {
+        if (command->validate()) {
+            ControllerThread::get().enqueue(command);
+        } else {
+            auto info = M1M3SSPublisher::get().getEventCommandRejectionWarning();
+            command->ackFailed(
+                    fmt::format("Command \"{}\" validation failed: {} ", info->command, info->reason));
             delete command;
         }
+    } catch (std::exception& ex) {
+        command->ackFailed(ex.what());
+        delete command;
     }
+    return true;
 }
 
 } /* namespace SS */
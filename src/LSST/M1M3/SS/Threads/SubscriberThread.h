@@ -25,6 +25,7 @@
 #define SUBSCRIBERTHREAD_H_
 
 #include <Command.h>
+#include <PollingBackoff.h>
 
 namespace LSST {
 namespace M1M3 {
@@ -32,6 +33,9 @@ namespace SS {
 
 /**
  * @brief The subscriber thread is responsible for accepting SAL commands.
+ *
+ * Polls all command and telemetry topics, sleeping between polls with
+ * PollingBackoff (100us after activity, up to 2ms when idle).
  */
 class SubscriberThread {
 public:
@@ -41,9 +45,17 @@ public:
     void stop();
 
 private:
-    void _enqueueCommandIfAvailable(Command* command);
+    /**
+     * Validates and enqueues command.
+     *
+     * @param command command to enqueue, can be nullptr
+     *
+     * @return true if command was received (command isn't nullptr)
+     */
+    bool _enqueueCommandIfAvailable(Command* command);
 
     bool _keepRunning;
+    PollingBackoff _backoff;
 };
 
 } /* namespace SS */
@@ -22,38 +22,100 @@
  */
 
 #include <CRC.h>
+
+#include <algorithm>
 #include <spdlog/spdlog.h>
 
 using namespace LSST::M1M3::SS;
 
-uint16_t CRC::modbus(uint8_t* buffer, int32_t startIndex, int32_t length) {
-    uint16_t crc = 0xFFFF;
-    for (int i = startIndex; i < startIndex + length; i++) {
-        crc = crc ^ ((uint16_t)buffer[i]);
-        for (int j = 0; j < 8; j++) {
-            if (crc & 0x0001) {
-                crc = crc >> 1;
-                crc = crc ^ 0xA001;
-            } else {
-                crc = crc >> 1;
+namespace {
+
+/**
+ * Lookup table for Modbus CRC16 (reflected 0x8005 polynomial, 0xA001).
+ * Calculated at compile time.
+ */
+struct ModbusCRCTable {
+    uint16_t values[256];
+
+    constexpr ModbusCRCTable() : values() {
+        for (int i = 0; i < 256; i++) {
+            uint16_t crc = i;
+            for (int j = 0; j < 8; j++) {
+                crc = (crc & 0x0001) ? ((crc >> 1) ^ 0xA001) : (crc >> 1);
             }
+            values[i] = crc;
         }
     }
+};
+
+constexpr ModbusCRCTable crcTable;
+
+}  // namespace
+
+const uint16_t* const CRC::_modbusTable = crcTable.values;
+
+uint16_t CRC::modbus(const uint8_t* buffer, int32_t startIndex, int32_t length) {
+    uint16_t crc = 0xFFFF;
+    for (int i = startIndex; i < startIndex + length; i++) {
+        crc = modbusStep(crc, buffer[i]);
+    }
     return crc;
 }
 
-uint16_t CRC::modbus(uint16_t* buffer, int32_t startIndex, int32_t length) {
+uint16_t CRC::modbus(const uint16_t* buffer, int32_t startIndex, int32_t length) {
     uint16_t crc = 0xFFFF;
     for (int i = startIndex; i < startIndex + length; i++) {
-        crc = crc ^ buffer[i];
-        for (int j = 0; j < 8; j++) {
-            if (crc & 0x0001) {
-                crc = crc >> 1;
-                crc = crc ^ 0xA001;
-            } else {
-                crc = crc >> 1;
+        crc = modbusStep(crc, static_cast<uint8_t>(buffer[i]));
+    }
+    return crc;
+}
+
+uint16_t CRC::modbusFIFO(const uint16_t* buffer, int32_t length) {
+    uint16_t crc = 0xFFFF;
+    for (int i = 0; i < length; i++) {
+        crc = modbusStep(crc, static_cast<uint8_t>(buffer[i] >> 1));
+    }
+    return crc;
+}
+
+ModbusCRCPatcher::ModbusCRCPatcher(size_t length) : _length(length), _nibbles(length * 32) {
+    // columns[bit] is final CRC change caused by flipping bit of CRC register after position
+    uint16_t columns[16];
+    for (int bit = 0; bit < 16; bit++) {
+        columns[bit] = 1 << bit;
+    }
+    for (size_t position = length; position-- > 0;) {
+        // CRC change caused by flipping each data bit at position
+        uint16_t dataColumns[8];
+        for (int dataBit = 0; dataBit < 8; dataBit++) {
+            dataColumns[dataBit] = _propagate(columns, CRC::modbusStep(0, 1 << dataBit));
+        }
+        uint16_t* nibbles = _nibbles.data() + position * 32;
+        for (int nibble = 0; nibble < 16; nibble++) {
+            nibbles[nibble] = 0;
+            nibbles[16 + nibble] = 0;
+            for (int bit = 0; bit < 4; bit++) {
+                if (nibble & (1 << bit)) {
+                    nibbles[nibble] ^= dataColumns[bit];
+                    nibbles[16 + nibble] ^= dataColumns[4 + bit];
+                }
             }
         }
+        // propagate columns through a zero byte
+        uint16_t previous[16];
+        std::copy(columns, columns + 16, previous);
+        for (int bit = 0; bit < 16; bit++) {
+            columns[bit] = _propagate(previous, CRC::modbusStep(1 << bit, 0));
+        }
     }
-    return crc;
+}
+
+uint16_t ModbusCRCPatcher::_propagate(const uint16_t* columns, uint16_t delta) {
+    uint16_t ret = 0;
+    for (int bit = 0; delta != 0; bit++, delta >>= 1) {
+        if (delta & 0x0001) {
+            ret ^= columns[bit];
+        }
+    }
+    return ret;
 }
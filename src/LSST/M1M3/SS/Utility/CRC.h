@@ -25,13 +25,16 @@
 #define CRC_H_
 
 #include <DataTypes.h>
+#include <cstddef>
+#include <vector>
 
 namespace LSST {
 namespace M1M3 {
 namespace SS {
 
 /**
- * CRC utility functions.
+ * CRC utility functions. Modbus CRC16 is calculated with 256 entries lookup
+ * table, processing a byte per step.
  */
 class CRC {
 public:
@@ -45,19 +48,89 @@ public:
      *
      * @return 16 bits Modbus CRC
      */
-    static uint16_t modbus(uint8_t* buffer, int32_t startIndex, int32_t length);
+    static uint16_t modbus(const uint8_t* buffer, int32_t startIndex, int32_t length);
 
     /**
      * Calculates 16 bit Modbus CRC. See (CRC calculator)[https://crccalc.com]
      * for checks.
      *
-     * @param buffer data buffer
+     * @param buffer data buffer. Only lower byte of each value is used.
      * @param startIndex start index
      * @param length data lenght
      *
      * @return 16 bits Modbus CRC
      */
-    static uint16_t modbus(uint16_t* buffer, int32_t startIndex, int32_t length);
+    static uint16_t modbus(const uint16_t* buffer, int32_t startIndex, int32_t length);
+
+    /**
+     * Calculates 16 bit Modbus CRC directly over FPGA FIFO words (see
+     * ModbusBuffer). Data byte is stored in bits 1-8 of a FIFO word. No
+     * memory is allocated.
+     *
+     * @param buffer FIFO words
+     * @param length number of words
+     *
+     * @return 16 bits Modbus CRC
+     */
+    static uint16_t modbusFIFO(const uint16_t* buffer, int32_t length);
+
+    /**
+     * Updates Modbus CRC with a single byte. Allows CRC to be calculated
+     * while data are processed. Start with 0xFFFF.
+     *
+     * @param crc current CRC value
+     * @param data next data byte
+     *
+     * @return updated CRC
+     */
+    static inline uint16_t modbusStep(uint16_t crc, uint8_t data) {
+        return (crc >> 8) ^ _modbusTable[(crc ^ data) & 0xFF];
+    }
+
+private:
+    static const uint16_t* const _modbusTable;
+};
+
+/**
+ * Updates Modbus CRC16 of a fixed length message when some of its bytes
+ * change, without recalculating CRC over the whole message. Modbus CRC is
+ * affine in message bits - CRC change depends only on changed bits and
+ * number of bytes following the change. CRC changes for every data nibble
+ * value are precomputed for every byte position, so patch takes constant time.
+ */
+class ModbusCRCPatcher {
+public:
+    /**
+     * Construct patcher for messages of given length.
+     *
+     * @param length message length (without CRC)
+     */
+    ModbusCRCPatcher(size_t length);
+
+    /**
+     * Returns CRC of the message with a byte changed.
+     *
+     * @param crc message CRC before the change
+     * @param position changed byte position (0 to length - 1)
+     * @param oldData byte value before the change
+     * @param newData new byte value
+     *
+     * @return CRC of the changed message
+     */
+    uint16_t patch(uint16_t crc, size_t position, uint8_t oldData, uint8_t newData) const {
+        uint8_t diff = oldData ^ newData;
+        const uint16_t* nibbles = _nibbles.data() + position * 32;
+        return crc ^ nibbles[diff & 0x0F] ^ nibbles[16 + (diff >> 4)];
+    }
+
+    size_t getLength() const { return _length; }
+
+private:
+    static uint16_t _propagate(const uint16_t* columns, uint16_t delta);
+
+    size_t _length;
+    // CRC changes caused by low (first 16) and high (next 16) data nibble changes, per position
+    std::vector<uint16_t> _nibbles;
 };
 
 } /* namespace SS */
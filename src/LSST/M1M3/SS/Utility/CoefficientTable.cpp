@@ -0,0 +1,45 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdexcept>
+
+#include <spdlog/fmt/fmt.h>
+
+#include <CoefficientTable.h>
+
+using namespace LSST::M1M3::SS;
+
+void CoefficientTable::set(const std::vector<float>& rowMajor, int columns) {
+    if (columns <= 0 || rowMajor.size() % columns != 0) {
+        throw std::invalid_argument(
+                fmt::format("Table with {} values cannot have {} columns", rowMajor.size(), columns));
+    }
+    _columns = columns;
+    _rows = rowMajor.size() / columns;
+    _data.resize(rowMajor.size());
+    for (int r = 0; r < _rows; r++) {
+        for (int c = 0; c < _columns; c++) {
+            _data[c * _rows + r] = rowMajor[r * _columns + c];
+        }
+    }
+}
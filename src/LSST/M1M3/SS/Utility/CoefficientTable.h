@@ -0,0 +1,77 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef COEFFICIENTTABLE_H_
+#define COEFFICIENTTABLE_H_
+
+#include <vector>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Coefficient-major (transposed) copy of a per-actuator table. Tables
+ * loaded from CSV files are row-major - all coefficients of an actuator
+ * follow each other. Storing each coefficient column contiguously allows
+ * kernels to loop over actuators with the coefficient fixed, which
+ * compilers vectorise.
+ */
+class CoefficientTable {
+public:
+    CoefficientTable() : _rows(0), _columns(0) {}
+
+    /**
+     * Fills table from row-major data.
+     *
+     * @param rowMajor row-major table, as loaded by TableLoader
+     * @param columns number of columns (coefficients) per row
+     *
+     * @throw std::invalid_argument if table size isn't multiple of columns
+     */
+    void set(const std::vector<float>& rowMajor, int columns);
+
+    bool empty() const { return _data.empty(); }
+    int getRows() const { return _rows; }
+    int getColumns() const { return _columns; }
+
+    /**
+     * Returns pointer to the column values.
+     *
+     * @param column column (coefficient) index
+     *
+     * @return getRows() column values
+     */
+    const float* getColumn(int column) const { return _data.data() + column * _rows; }
+
+private:
+    std::vector<float> _data;
+    int _rows;
+    int _columns;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* COEFFICIENTTABLE_H_ */
@@ -29,6 +29,8 @@ namespace LSST {
 namespace M1M3 {
 namespace SS {
 
+ForceConverter::Kernel ForceConverter::_kernel = ForceConverter::TRANSPOSED;
+
 ForcesAndMoments ForceConverter::calculateForcesAndMoments(
         ForceActuatorApplicationSettings* forceActuatorApplicationSettings,
         ForceActuatorSettings* forceActuatorSettings, float* xForces, float* yForces, float* zForces) {
@@ -105,6 +107,17 @@ DistributedForces ForceConverter::calculateForceFromAngularAcceleration(
         ForceActuatorSettings* forceActuatorSettings, float angularAccelerationX, float angularAccelerationY,
         float angularAccelerationZ) {
     DistributedForces forces;
+    if (_useTransposed(forceActuatorSettings->AccelerationXTransposed)) {
+        const CoefficientTable* tables[] = {&forceActuatorSettings->AccelerationXTransposed,
+                                            &forceActuatorSettings->AccelerationYTransposed,
+                                            &forceActuatorSettings->AccelerationZTransposed};
+        float weights[] = {angularAccelerationX, angularAccelerationY, angularAccelerationZ};
+        _transposedProduct(tables, weights, 3, 0, forces.XForces);
+        _transposedProduct(tables, weights, 3, 1, forces.YForces);
+        _transposedProduct(tables, weights, 3, 2, forces.ZForces);
+        return forces;
+    }
+
     for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
         int mIndex = zIndex * 3;
 
@@ -139,6 +152,19 @@ DistributedForces ForceConverter::calculateForceFromAngularVelocity(
     float angularVelocityXZ = angularVelocityX * angularVelocityZ;
     float angularVelocityYZ = angularVelocityY * angularVelocityZ;
     DistributedForces forces;
+    if (_useTransposed(forceActuatorSettings->VelocityXTransposed)) {
+        const CoefficientTable* tables[] = {
+                &forceActuatorSettings->VelocityXTransposed, &forceActuatorSettings->VelocityYTransposed,
+                &forceActuatorSettings->VelocityZTransposed, &forceActuatorSettings->VelocityXZTransposed,
+                &forceActuatorSettings->VelocityYZTransposed};
+        float weights[] = {angularVelocityXX, angularVelocityYY, angularVelocityZZ, angularVelocityXZ,
+                           angularVelocityYZ};
+        _transposedProduct(tables, weights, 5, 0, forces.XForces);
+        _transposedProduct(tables, weights, 5, 1, forces.YForces);
+        _transposedProduct(tables, weights, 5, 2, forces.ZForces);
+        return forces;
+    }
+
     for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
         int mIndex = zIndex * 3;
 
@@ -169,106 +195,39 @@ DistributedForces ForceConverter::calculateForceFromAngularVelocity(
 
 DistributedForces ForceConverter::calculateForceFromAzimuthAngle(ForceActuatorSettings* forceActuatorSettings,
                                                                  float azimuthAngle) {
-    float azimuthMatrix[] = {std::pow(azimuthAngle, 5.0f),
-                             std::pow(azimuthAngle, 4.0f),
-                             std::pow(azimuthAngle, 3.0f),
-                             std::pow(azimuthAngle, 2.0f),
-                             azimuthAngle,
-                             1.0f};
     DistributedForces forces;
-    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
-        int mIndex = zIndex * 6;
-        forces.XForces[zIndex] = forceActuatorSettings->AzimuthXTable[mIndex + 0] * azimuthMatrix[0] +
-                                 forceActuatorSettings->AzimuthXTable[mIndex + 1] * azimuthMatrix[1] +
-                                 forceActuatorSettings->AzimuthXTable[mIndex + 2] * azimuthMatrix[2] +
-                                 forceActuatorSettings->AzimuthXTable[mIndex + 3] * azimuthMatrix[3] +
-                                 forceActuatorSettings->AzimuthXTable[mIndex + 4] * azimuthMatrix[4] +
-                                 forceActuatorSettings->AzimuthXTable[mIndex + 5];
-
-        forces.YForces[zIndex] = forceActuatorSettings->AzimuthYTable[mIndex + 0] * azimuthMatrix[0] +
-                                 forceActuatorSettings->AzimuthYTable[mIndex + 1] * azimuthMatrix[1] +
-                                 forceActuatorSettings->AzimuthYTable[mIndex + 2] * azimuthMatrix[2] +
-                                 forceActuatorSettings->AzimuthYTable[mIndex + 3] * azimuthMatrix[3] +
-                                 forceActuatorSettings->AzimuthYTable[mIndex + 4] * azimuthMatrix[4] +
-                                 forceActuatorSettings->AzimuthYTable[mIndex + 5];
-
-        forces.ZForces[zIndex] = forceActuatorSettings->AzimuthZTable[mIndex + 0] * azimuthMatrix[0] +
-                                 forceActuatorSettings->AzimuthZTable[mIndex + 1] * azimuthMatrix[1] +
-                                 forceActuatorSettings->AzimuthZTable[mIndex + 2] * azimuthMatrix[2] +
-                                 forceActuatorSettings->AzimuthZTable[mIndex + 3] * azimuthMatrix[3] +
-                                 forceActuatorSettings->AzimuthZTable[mIndex + 4] * azimuthMatrix[4] +
-                                 forceActuatorSettings->AzimuthZTable[mIndex + 5];
+    if (forceActuatorSettings->AzimuthLookup.contains(azimuthAngle)) {
+        forceActuatorSettings->AzimuthLookup.interpolate(azimuthAngle, forces);
+        return forces;
     }
+    _polynomial(forceActuatorSettings->AzimuthXTable, forceActuatorSettings->AzimuthYTable,
+                forceActuatorSettings->AzimuthZTable, forceActuatorSettings->AzimuthXTransposed,
+                forceActuatorSettings->AzimuthYTransposed, forceActuatorSettings->AzimuthZTransposed,
+                azimuthAngle, forces);
     return forces;
 }
 
 DistributedForces ForceConverter::calculateForceFromElevationAngle(
         ForceActuatorSettings* forceActuatorSettings, float elevationAngle) {
-    float elevationMatrix[] = {std::pow(elevationAngle, 5.0f),
-                               std::pow(elevationAngle, 4.0f),
-                               std::pow(elevationAngle, 3.0f),
-                               std::pow(elevationAngle, 2.0f),
-                               elevationAngle,
-                               1.0f};
     DistributedForces forces;
-    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
-        int mIndex = zIndex * 6;
-        forces.XForces[zIndex] = forceActuatorSettings->ElevationXTable[mIndex + 0] * elevationMatrix[0] +
-                                 forceActuatorSettings->ElevationXTable[mIndex + 1] * elevationMatrix[1] +
-                                 forceActuatorSettings->ElevationXTable[mIndex + 2] * elevationMatrix[2] +
-                                 forceActuatorSettings->ElevationXTable[mIndex + 3] * elevationMatrix[3] +
-                                 forceActuatorSettings->ElevationXTable[mIndex + 4] * elevationMatrix[4] +
-                                 forceActuatorSettings->ElevationXTable[mIndex + 5];
-
-        forces.YForces[zIndex] = forceActuatorSettings->ElevationYTable[mIndex + 0] * elevationMatrix[0] +
-                                 forceActuatorSettings->ElevationYTable[mIndex + 1] * elevationMatrix[1] +
-                                 forceActuatorSettings->ElevationYTable[mIndex + 2] * elevationMatrix[2] +
-                                 forceActuatorSettings->ElevationYTable[mIndex + 3] * elevationMatrix[3] +
-                                 forceActuatorSettings->ElevationYTable[mIndex + 4] * elevationMatrix[4] +
-                                 forceActuatorSettings->ElevationYTable[mIndex + 5];
-
-        forces.ZForces[zIndex] = forceActuatorSettings->ElevationZTable[mIndex + 0] * elevationMatrix[0] +
-                                 forceActuatorSettings->ElevationZTable[mIndex + 1] * elevationMatrix[1] +
-                                 forceActuatorSettings->ElevationZTable[mIndex + 2] * elevationMatrix[2] +
-                                 forceActuatorSettings->ElevationZTable[mIndex + 3] * elevationMatrix[3] +
-                                 forceActuatorSettings->ElevationZTable[mIndex + 4] * elevationMatrix[4] +
-                                 forceActuatorSettings->ElevationZTable[mIndex + 5];
+    if (forceActuatorSettings->ElevationLookup.contains(elevationAngle)) {
+        forceActuatorSettings->ElevationLookup.interpolate(elevationAngle, forces);
+        return forces;
     }
+    _polynomial(forceActuatorSettings->ElevationXTable, forceActuatorSettings->ElevationYTable,
+                forceActuatorSettings->ElevationZTable, forceActuatorSettings->ElevationXTransposed,
+                forceActuatorSettings->ElevationYTransposed, forceActuatorSettings->ElevationZTransposed,
+                elevationAngle, forces);
     return forces;
 }
 
 DistributedForces ForceConverter::calculateForceFromTemperature(ForceActuatorSettings* forceActuatorSettings,
                                                                 float temperature) {
-    float temperatureMatrix[] = {std::pow(temperature, 5.0f),
-                                 std::pow(temperature, 4.0f),
-                                 std::pow(temperature, 3.0f),
-                                 std::pow(temperature, 2.0f),
-                                 temperature,
-                                 1.0f};
     DistributedForces forces;
-    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
-        int mIndex = zIndex * 6;
-        forces.XForces[zIndex] = forceActuatorSettings->ThermalXTable[mIndex + 0] * temperatureMatrix[0] +
-                                 forceActuatorSettings->ThermalXTable[mIndex + 1] * temperatureMatrix[1] +
-                                 forceActuatorSettings->ThermalXTable[mIndex + 2] * temperatureMatrix[2] +
-                                 forceActuatorSettings->ThermalXTable[mIndex + 3] * temperatureMatrix[3] +
-                                 forceActuatorSettings->ThermalXTable[mIndex + 4] * temperatureMatrix[4] +
-                                 forceActuatorSettings->ThermalXTable[mIndex + 5];
-
-        forces.YForces[zIndex] = forceActuatorSettings->ThermalYTable[mIndex + 0] * temperatureMatrix[0] +
-                                 forceActuatorSettings->ThermalYTable[mIndex + 1] * temperatureMatrix[1] +
-                                 forceActuatorSettings->ThermalYTable[mIndex + 2] * temperatureMatrix[2] +
-                                 forceActuatorSettings->ThermalYTable[mIndex + 3] * temperatureMatrix[3] +
-                                 forceActuatorSettings->ThermalYTable[mIndex + 4] * temperatureMatrix[4] +
-                                 forceActuatorSettings->ThermalYTable[mIndex + 5];
-
-        forces.ZForces[zIndex] = forceActuatorSettings->ThermalZTable[mIndex + 0] * temperatureMatrix[0] +
-                                 forceActuatorSettings->ThermalZTable[mIndex + 1] * temperatureMatrix[1] +
-                                 forceActuatorSettings->ThermalZTable[mIndex + 2] * temperatureMatrix[2] +
-                                 forceActuatorSettings->ThermalZTable[mIndex + 3] * temperatureMatrix[3] +
-                                 forceActuatorSettings->ThermalZTable[mIndex + 4] * temperatureMatrix[4] +
-                                 forceActuatorSettings->ThermalZTable[mIndex + 5];
-    }
+    _polynomial(forceActuatorSettings->ThermalXTable, forceActuatorSettings->ThermalYTable,
+                forceActuatorSettings->ThermalZTable, forceActuatorSettings->ThermalXTransposed,
+                forceActuatorSettings->ThermalYTransposed, forceActuatorSettings->ThermalZTransposed,
+                temperature, forces);
     return forces;
 }
 
@@ -303,6 +262,91 @@ DistributedForces ForceConverter::calculateForceDistribution(ForceActuatorSettin
     return forces;
 }
 
+void ForceConverter::_polynomial(const std::vector<float>& xTable, const std::vector<float>& yTable,
+                                 const std::vector<float>& zTable, const CoefficientTable& xTransposed,
+                                 const CoefficientTable& yTransposed, const CoefficientTable& zTransposed,
+                                 float value, DistributedForces& forces) {
+    if (_useTransposed(xTransposed) && _kernel == HORNER) {
+        _hornerPolynomial(xTransposed, value, forces.XForces);
+        _hornerPolynomial(yTransposed, value, forces.YForces);
+        _hornerPolynomial(zTransposed, value, forces.ZForces);
+        return;
+    }
+
+    float powers[] = {std::pow(value, 5.0f), std::pow(value, 4.0f), std::pow(value, 3.0f),
+                      std::pow(value, 2.0f), value};
+    if (_useTransposed(xTransposed)) {
+        _transposedPolynomial(xTransposed, powers, forces.XForces);
+        _transposedPolynomial(yTransposed, powers, forces.YForces);
+        _transposedPolynomial(zTransposed, powers, forces.ZForces);
+    } else {
+        _scalarPolynomial(xTable, powers, forces.XForces);
+        _scalarPolynomial(yTable, powers, forces.YForces);
+        _scalarPolynomial(zTable, powers, forces.ZForces);
+    }
+}
+
+void ForceConverter::_scalarPolynomial(const std::vector<float>& table, const float* powers, float* forces) {
+    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
+        int mIndex = zIndex * 6;
+        forces[zIndex] = table[mIndex + 0] * powers[0] + table[mIndex + 1] * powers[1] +
+                         table[mIndex + 2] * powers[2] + table[mIndex + 3] * powers[3] +
+                         table[mIndex + 4] * powers[4] + table[mIndex + 5];
+    }
+}
+
+void ForceConverter::_transposedPolynomial(const CoefficientTable& table, const float* powers,
+                                           float* forces) {
+    // same operations order as in _scalarPolynomial
+    const float* c0 = table.getColumn(0);
+    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
+        forces[zIndex] = c0[zIndex] * powers[0];
+    }
+    for (int c = 1; c < 5; ++c) {
+        const float* coefficients = table.getColumn(c);
+        float power = powers[c];
+        for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
+            forces[zIndex] += coefficients[zIndex] * power;
+        }
+    }
+    const float* c5 = table.getColumn(5);
+    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
+        forces[zIndex] += c5[zIndex];
+    }
+}
+
+void ForceConverter::_hornerPolynomial(const CoefficientTable& table, float value, float* forces) {
+    const float* c0 = table.getColumn(0);
+    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
+        forces[zIndex] = c0[zIndex];
+    }
+    for (int c = 1; c < 6; ++c) {
+        const float* coefficients = table.getColumn(c);
+        for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
+            forces[zIndex] = forces[zIndex] * value + coefficients[zIndex];
+        }
+    }
+}
+
+void ForceConverter::_transposedProduct(const CoefficientTable* const* tables, const float* weights,
+                                        int count, int column, float* forces) {
+    // same operations order as in scalar calculateForceFromAngular.. methods
+    const float* t0 = tables[0]->getColumn(column);
+    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
+        forces[zIndex] = t0[zIndex] * weights[0];
+    }
+    for (int t = 1; t < count; ++t) {
+        const float* coefficients = tables[t]->getColumn(column);
+        float weight = weights[t];
+        for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
+            forces[zIndex] += coefficients[zIndex] * weight;
+        }
+    }
+    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
+        forces[zIndex] = forces[zIndex] / 1000.0;
+    }
+}
+
 } /* namespace SS */
 } /* namespace M1M3 */
 } /* namespace LSST */
@@ -24,10 +24,12 @@
 #ifndef FORCECONVERTER_H_
 #define FORCECONVERTER_H_
 
+#include <CoefficientTable.h>
 #include <DataTypes.h>
 #include <cmath>
 #include <ForcesAndMoments.h>
 #include <DistributedForces.h>
+#include <vector>
 
 namespace LSST {
 namespace M1M3 {
@@ -38,6 +40,30 @@ class ForceActuatorSettings;
 
 class ForceConverter {
 public:
+    /**
+     * Kernels evaluating per-actuator polynomials (azimuth, elevation and
+     * thermal tables) and matrix products (acceleration and velocity tables).
+     */
+    enum Kernel {
+        /// row-major tables, all coefficients of an actuator at once
+        SCALAR,
+        /// coefficient-major tables, looping over all actuators for each
+        /// coefficient. Results are bit-for-bit identical to SCALAR
+        TRANSPOSED,
+        /// as TRANSPOSED, but polynomials are evaluated with Horner's
+        /// scheme. Results differ from SCALAR in rounding
+        HORNER
+    };
+
+    /**
+     * Selects kernel used for polynomial and matrix evaluations. SCALAR is
+     * used when settings don't provide transposed tables.
+     *
+     * @param kernel new kernel
+     */
+    static void setKernel(Kernel kernel) { _kernel = kernel; }
+    static Kernel getKernel() { return _kernel; }
+
     static void daaPositiveXToMirror(float primaryCylinder, float secondaryCylinder, float* xForce,
                                      float* yForce, float* zForce) {
         *xForce = secondaryCylinder * _reciprocalSqrt2;
@@ -86,6 +112,11 @@ public:
     static DistributedForces calculateForceFromAngularVelocity(ForceActuatorSettings* forceActuatorSettings,
                                                                float angularVelocityX, float angularVelocityY,
                                                                float angularVelocityZ);
+    /**
+     * Calculates azimuth (elevation) forces. Forces are interpolated from
+     * ForceActuatorSettings lookup grid if the angle is inside its range,
+     * otherwise evaluated from polynomials.
+     */
     static DistributedForces calculateForceFromAzimuthAngle(ForceActuatorSettings* forceActuatorSettings,
                                                             float azimuthAngle);
     static DistributedForces calculateForceFromElevationAngle(ForceActuatorSettings* forceActuatorSettings,
@@ -98,6 +129,42 @@ public:
 
 private:
     static double constexpr _reciprocalSqrt2 = 0.70710678118654752440084436210485;
+
+    static Kernel _kernel;
+
+    static bool _useTransposed(const CoefficientTable& table) {
+        return _kernel != SCALAR && table.getRows() == FA_COUNT;
+    }
+
+    /**
+     * Evaluates 5th order polynomials of all actuators for X, Y and Z
+     * forces.
+     *
+     * @param xTable row-major X coefficients, 6 per actuator, highest order first
+     * @param xTransposed coefficient-major copy of xTable
+     * @param value polynomial variable
+     * @param forces calculated forces
+     */
+    static void _polynomial(const std::vector<float>& xTable, const std::vector<float>& yTable,
+                            const std::vector<float>& zTable, const CoefficientTable& xTransposed,
+                            const CoefficientTable& yTransposed, const CoefficientTable& zTransposed,
+                            float value, DistributedForces& forces);
+    static void _scalarPolynomial(const std::vector<float>& table, const float* powers, float* forces);
+    static void _transposedPolynomial(const CoefficientTable& table, const float* powers, float* forces);
+    static void _hornerPolynomial(const CoefficientTable& table, float value, float* forces);
+
+    /**
+     * Calculates weighted sum of the given column of transposed tables,
+     * divided by 1000.
+     *
+     * @param tables coefficient-major tables
+     * @param weights table weights
+     * @param count number of tables and weights
+     * @param column table column to sum
+     * @param forces calculated forces
+     */
+    static void _transposedProduct(const CoefficientTable* const* tables, const float* weights, int count,
+                                   int column, float* forces);
 };
 
 } /* namespace SS */
@@ -0,0 +1,88 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <spdlog/fmt/fmt.h>
+
+#include <ForceLookupGrid.h>
+
+using namespace LSST::M1M3::SS;
+
+static void blend(const float* a, const float* b, float t, float* forces) {
+    for (int i = 0; i < FA_COUNT; i++) {
+        forces[i] = a[i] + t * (b[i] - a[i]);
+    }
+}
+
+void ForceLookupGrid::build(float min, float max, float step, const Evaluator& evaluate) {
+    if (!(step > 0) || !(max > min)) {
+        throw std::invalid_argument(fmt::format("Invalid lookup grid {} - {} step {}", min, max, step));
+    }
+    // tolerate rounding of decimal steps, 0.01 isn't exact in binary
+    int count = static_cast<int>(std::ceil(static_cast<double>(max - min) / step - 1e-3)) + 1;
+    std::vector<DistributedForces> rows(count);
+    for (int i = 0; i < count; i++) {
+        evaluate(min + i * step, rows[i]);
+    }
+    _rows.swap(rows);
+    _min = min;
+    _max = min + (count - 1) * step;
+    _step = step;
+}
+
+float ForceLookupGrid::verify(const Evaluator& evaluate) const {
+    float maxError = 0;
+    DistributedForces interpolated;
+    DistributedForces evaluated;
+    for (size_t i = 0; i + 1 < _rows.size(); i++) {
+        float value = _min + (i + 0.5f) * _step;
+        interpolate(value, interpolated);
+        evaluate(value, evaluated);
+        for (int j = 0; j < FA_COUNT; j++) {
+            maxError = std::max(maxError, std::abs(interpolated.XForces[j] - evaluated.XForces[j]));
+            maxError = std::max(maxError, std::abs(interpolated.YForces[j] - evaluated.YForces[j]));
+            maxError = std::max(maxError, std::abs(interpolated.ZForces[j] - evaluated.ZForces[j]));
+        }
+    }
+    return maxError;
+}
+
+void ForceLookupGrid::clear() {
+    _rows.clear();
+    _rows.shrink_to_fit();
+}
+
+void ForceLookupGrid::interpolate(float value, DistributedForces& forces) const {
+    float position = (value - _min) / _step;
+    int index = std::min(static_cast<int>(position), static_cast<int>(_rows.size()) - 2);
+    index = std::max(index, 0);
+    float t = position - index;
+    const DistributedForces& a = _rows[index];
+    const DistributedForces& b = _rows[index + 1];
+    blend(a.XForces, b.XForces, t, forces.XForces);
+    blend(a.YForces, b.YForces, t, forces.YForces);
+    blend(a.ZForces, b.ZForces, t, forces.ZForces);
+}
@@ -0,0 +1,103 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef FORCELOOKUPGRID_H_
+#define FORCELOOKUPGRID_H_
+
+#include <functional>
+#include <vector>
+
+#include <DistributedForces.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Precomputed forces on an equidistant grid. Forces between grid points are
+ * linearly interpolated from the two neighbouring rows, replacing evaluation
+ * of per-actuator polynomials with a blend of two cached rows.
+ */
+class ForceLookupGrid {
+public:
+    typedef std::function<void(float, DistributedForces&)> Evaluator;
+
+    ForceLookupGrid() : _min(0), _max(0), _step(0) {}
+
+    /**
+     * Evaluates forces on all grid points.
+     *
+     * @param min grid start
+     * @param max grid end, included in the grid
+     * @param step grid step
+     * @param evaluate calculates forces for given value
+     *
+     * @throw std::invalid_argument if range or step are invalid
+     */
+    void build(float min, float max, float step, const Evaluator& evaluate);
+
+    /**
+     * Returns the largest absolute difference between interpolated and
+     * evaluated forces. Evaluated at cell midpoints, where linear interpolation
+     * error of a smooth function peaks.
+     *
+     * @param evaluate calculates forces for given value
+     *
+     * @return maximal interpolation error
+     */
+    float verify(const Evaluator& evaluate) const;
+
+    void clear();
+    bool empty() const { return _rows.empty(); }
+    size_t size() const { return _rows.size(); }
+
+    /**
+     * Returns memory occupied by grid rows. Each row holds X, Y and Z forces
+     * of all force actuators.
+     *
+     * @return grid size in bytes
+     */
+    size_t memorySize() const { return _rows.size() * sizeof(DistributedForces); }
+
+    bool contains(float value) const { return !empty() && value >= _min && value <= _max; }
+
+    /**
+     * Interpolates forces for a value inside grid range.
+     *
+     * @param value value, contains(value) must be true
+     * @param forces interpolated forces
+     */
+    void interpolate(float value, DistributedForces& forces) const;
+
+private:
+    std::vector<DistributedForces> _rows;
+    float _min;
+    float _max;
+    float _step;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* FORCELOOKUPGRID_H_ */
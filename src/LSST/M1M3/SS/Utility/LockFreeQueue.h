@@ -0,0 +1,137 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOCKFREEQUEUE_H_
+#define LOCKFREEQUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Bounded lock-free multiple producers, multiple consumers queue. Items are stored in a
+ * preallocated ring buffer, each cell carries a sequence number telling if
+ * the cell is ready for writing or reading. Neither push nor pop allocates
+ * memory or takes a lock, so both can be called from real-time threads (and
+ * push even from a signal handler).
+ *
+ * @tparam T stored item type (usually a pointer)
+ * @tparam N queue capacity, must be power of 2
+ */
+template <typename T, size_t N>
+class LockFreeQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "LockFreeQueue capacity must be power of 2");
+
+public:
+    LockFreeQueue() : _pushPosition(0), _popPosition(0) {
+        for (size_t i = 0; i < N; i++) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Push item at the end of the queue.
+     *
+     * @param item item to push
+     *
+     * @return false if the queue is full, true if item was stored
+     */
+    bool push(const T& item) {
+        Cell* cell;
+        size_t pos = _pushPosition.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &_cells[pos & (N - 1)];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (_pushPosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _pushPosition.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = item;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Pop item from the front of the queue.
+     *
+     * @param item retrieved item
+     *
+     * @return false if the queue is empty, true if item was retrieved
+     */
+    bool pop(T& item) {
+        Cell* cell;
+        size_t pos = _popPosition.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &_cells[pos & (N - 1)];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_popPosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _popPosition.load(std::memory_order_relaxed);
+            }
+        }
+        item = cell->data;
+        cell->sequence.store(pos + N, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Returns queue capacity.
+     *
+     * @return maximal number of items the queue can hold
+     */
+    static constexpr size_t capacity() { return N; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    // keep producers and consumer positions on separate cache lines
+    alignas(64) Cell _cells[N];
+    alignas(64) std::atomic<size_t> _pushPosition;
+    alignas(64) std::atomic<size_t> _popPosition;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* LOCKFREEQUEUE_H_ */
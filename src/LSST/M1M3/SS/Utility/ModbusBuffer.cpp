@@ -22,6 +22,7 @@
  */
 
 #include <ModbusBuffer.h>
+#include <CRC.h>
 #include <IFPGA.h>
 #include <Timestamp.h>
 #include <string.h>
@@ -99,20 +100,8 @@ std::vector<uint8_t> ModbusBuffer::getReadData(int32_t length) {
     return data;
 }
 
-uint16_t ModbusBuffer::calculateCRC(std::vector<uint8_t> data) {
-    uint16_t crc = 0xFFFF;
-    for (auto i : data) {
-        crc = crc ^ (uint16_t(i));
-        for (int j = 0; j < 8; j++) {
-            if (crc & 0x0001) {
-                crc = crc >> 1;
-                crc = crc ^ 0xA001;
-            } else {
-                crc = crc >> 1;
-            }
-        }
-    }
-    return crc;
+uint16_t ModbusBuffer::calculateCRC(const std::vector<uint8_t>& data) {
+    return CRC::modbus(data.data(), 0, data.size());
 }
 
 uint16_t ModbusBuffer::calculateCRC(int32_t length) {
@@ -122,7 +111,7 @@ uint16_t ModbusBuffer::calculateCRC(int32_t length) {
     }
     std::cout << std::endl;
 #endif
-    return calculateCRC(getReadData(length));
+    return CRC::modbusFIFO(_buffer + _index - length, length);
 }
 
 uint16_t ModbusBuffer::readLength() { return _buffer[_index++]; }
@@ -302,6 +291,11 @@ void ModbusBuffer::writeWaitForRx(uint32_t timeoutMicros) {
                                                : (timeoutMicros | FIFO_TX_WAIT_RX);
 }
 
+void ModbusBuffer::writeInstructions(const uint16_t* instructions, int32_t length) {
+    memcpy(_buffer + _index, instructions, length * sizeof(uint16_t));
+    _index += length;
+}
+
 void ModbusBuffer::pullModbusResponse(uint16_t request, uint64_t& beginTs, uint64_t& endTs,
                                       std::vector<uint8_t>& data) {
     IFPGA::get().writeRequestFIFO(request, 0);
@@ -76,10 +76,11 @@ public:
      *
      * @return calculated Modbus CRC16
      */
-    static uint16_t calculateCRC(std::vector<uint8_t> data);
+    static uint16_t calculateCRC(const std::vector<uint8_t>& data);
 
     /**
-     * Calculate Modbus from written data
+     * Calculate Modbus from written data. Calculated directly over FIFO
+     * words, without any memory allocation.
      *
      * @param length buffer length
      *
@@ -139,6 +140,14 @@ public:
     void writeTriggerIRQ();
     void writeWaitForRx(uint32_t timeoutMicros);
 
+    /**
+     * Copies already encoded FPGA TX FIFO instructions into buffer.
+     *
+     * @param instructions encoded instructions (see ILCFrameTable)
+     * @param length number of instructions
+     */
+    void writeInstructions(const uint16_t* instructions, int32_t length);
+
     /**
      * Fills buffer with data from response, returns start and end timestamps.
      * Checks for CRC.
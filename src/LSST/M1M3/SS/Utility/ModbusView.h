@@ -0,0 +1,159 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MODBUSVIEW_H_
+#define MODBUSVIEW_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Non-owning, bounds-checked read cursor over Modbus response FIFO words.
+ * Decodes big endian ILC payload values directly from the response buffer,
+ * without any memory allocation. Data bytes are stored in bits 1-8 of a FIFO
+ * word (see ModbusBuffer).
+ *
+ * Reads past the end of the view throws std::out_of_range. The view doesn't
+ * own the data - the underlying buffer must outlive it.
+ */
+class ModbusView {
+public:
+    /**
+     * Construct view.
+     *
+     * @param data first FIFO word of the view
+     * @param length number of words in the view
+     */
+    ModbusView(const uint16_t* data, size_t length) : _data(data), _length(length), _position(0) {}
+
+    /**
+     * Returns number of words in the view.
+     */
+    size_t size() const { return _length; }
+
+    /**
+     * Returns cursor position, relative to view start.
+     */
+    size_t position() const { return _position; }
+
+    /**
+     * Returns number of words not yet read.
+     */
+    size_t remaining() const { return _length - _position; }
+
+    /**
+     * Advance cursor by given number of words.
+     *
+     * @param length number of words to skip
+     *
+     * @throw std::out_of_range when skipping past view end
+     */
+    void skip(size_t length) {
+        _require(length);
+        _position += length;
+    }
+
+    /**
+     * Returns byte at given offset from view start. Doesn't move the cursor.
+     *
+     * @param offset byte offset
+     *
+     * @throw std::out_of_range when offset isn't inside the view
+     */
+    uint8_t at(size_t offset) const {
+        if (offset >= _length) {
+            _outOfRange(offset, 1);
+        }
+        return _byte(offset);
+    }
+
+    uint8_t readU8() {
+        _require(1);
+        return _byte(_position++);
+    }
+
+    uint16_t readU16() { return static_cast<uint16_t>(_readBE(2)); }
+
+    uint32_t readU32() { return static_cast<uint32_t>(_readBE(4)); }
+
+    int32_t readI32() { return static_cast<int32_t>(_readBE(4)); }
+
+    uint64_t readU48() { return _readBE(6); }
+
+    float readSGL() {
+        uint32_t raw = readU32();
+        float data;
+        memcpy(&data, &raw, sizeof(float));
+        return data;
+    }
+
+    /**
+     * Copy payload bytes into caller provided buffer.
+     *
+     * @param dest destination, must hold at least length bytes
+     * @param length number of bytes to copy
+     *
+     * @throw std::out_of_range when reading past view end
+     */
+    void readBytes(uint8_t* dest, size_t length) {
+        _require(length);
+        for (size_t i = 0; i < length; i++) {
+            dest[i] = _byte(_position++);
+        }
+    }
+
+private:
+    const uint16_t* _data;
+    size_t _length;
+    size_t _position;
+
+    uint8_t _byte(size_t offset) const { return static_cast<uint8_t>(_data[offset] >> 1); }
+
+    uint64_t _readBE(size_t length) {
+        _require(length);
+        uint64_t ret = 0;
+        for (size_t i = 0; i < length; i++) {
+            ret = (ret << 8) | _byte(_position++);
+        }
+        return ret;
+    }
+
+    void _require(size_t length) const {
+        if (length > _length - _position) {
+            _outOfRange(_position, length);
+        }
+    }
+
+    [[noreturn]] void _outOfRange(size_t offset, size_t length) const;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* MODBUSVIEW_H_ */
@@ -0,0 +1,96 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <ModbusWireTime.h>
+#include <FPGAAddresses.h>
+
+#include <stdexcept>
+#include <spdlog/fmt/fmt.h>
+
+using namespace LSST::M1M3::SS;
+
+ModbusWireTime::ModbusWireTime(uint32_t baudRate, int bitsPerCharacter) {
+    _characterTime = bitsPerCharacter * 1000000.0 / baudRate;
+}
+
+std::vector<SubnetWireTime> ModbusWireTime::analyze(const uint16_t* buffer, int32_t length) const {
+    std::vector<SubnetWireTime> ret;
+    int32_t index = 0;
+    while (index < length) {
+        if (index + 1 >= length) {
+            throw std::runtime_error(fmt::format("ModbusWireTime: missing subnet length at {}", index));
+        }
+        SubnetWireTime subnet = {-1, static_cast<uint8_t>(buffer[index]), 0, 0, 0, 0};
+        for (int i = 0; i < SUBNET_COUNT; i++) {
+            if (FPGAAddresses::ModbusSubnetsTx[i] == subnet.txAddress) {
+                subnet.subnet = i;
+                break;
+            }
+        }
+        int32_t end = index + 2 + buffer[index + 1];
+        if (end > length) {
+            throw std::runtime_error(
+                    fmt::format("ModbusWireTime: subnet {} at {} ends at {}, behind buffer end {}",
+                                subnet.txAddress, index, end, length));
+        }
+        for (index += 2; index < end; index++) {
+            _addInstruction(subnet, buffer[index]);
+        }
+        ret.push_back(subnet);
+    }
+    return ret;
+}
+
+const SubnetWireTime* ModbusWireTime::busiest(const std::vector<SubnetWireTime>& subnets) {
+    const SubnetWireTime* ret = nullptr;
+    for (auto& s : subnets) {
+        if (ret == nullptr || s.total() > ret->total()) {
+            ret = &s;
+        }
+    }
+    return ret;
+}
+
+void ModbusWireTime::_addInstruction(SubnetWireTime& subnet, uint16_t instruction) const {
+    uint16_t value = instruction & 0x0FFF;
+    switch (instruction & 0xF000) {
+        case 0x1000:  // byte write
+            subnet.txBytes++;
+            subnet.txTime += _characterTime;
+            break;
+        case 0x2000:  // end of frame
+            subnet.frames++;
+            subnet.txTime += getFrameEndTime();
+            break;
+        case 0x4000:  // wait us
+        case 0x6000:  // wait for response, timeout in us
+            subnet.waitTime += value;
+            break;
+        case 0x5000:  // wait ms
+        case 0x9000:  // wait for response, timeout in ms
+            subnet.waitTime += value * 1000.0;
+            break;
+        default:  // timestamp, triggers, IRQ, nop
+            break;
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MODBUSWIRETIME_H_
+#define MODBUSWIRETIME_H_
+
+#include <DataTypes.h>
+#include <vector>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Predicted wire time of a single subnet transaction. Times are in
+ * microseconds.
+ */
+struct SubnetWireTime {
+    /// subnet index (0-4, A-E), -1 for unknown transmit address
+    int subnet;
+    /// FPGA transmit address the subnet was written to
+    uint8_t txAddress;
+    /// number of Modbus frames (FRAMEEND instructions)
+    int32_t frames;
+    /// number of bytes written to the bus
+    int32_t txBytes;
+    /// time spent transmitting bytes and inter-frame silence
+    double txTime;
+    /// time spent in delays and waiting for ILC responses
+    double waitTime;
+
+    double total() const { return txTime + waitTime; }
+};
+
+/**
+ * Static analyser of encoded Modbus transmit buffers. Walks FPGA TX FIFO
+ * instructions (see ModbusBuffer) of a BusList and predicts how long each
+ * subnet transaction occupies the bus. As all subnets run in parallel, the
+ * busiest subnet determines Modbus part of the outer loop cycle.
+ *
+ * The model is conservative - response waits (WAIT_RX) are counted with
+ * their full timeout, as that's the time reserved for the ILC reply.
+ * Timestamp, trigger and IRQ instructions take no time.
+ */
+class ModbusWireTime {
+public:
+    /**
+     * @param baudRate bus speed (bits per second)
+     * @param bitsPerCharacter bits on the wire per byte (start, data, parity
+     * and stop bits). FPGA writes 1 start, 8 data and 1 stop bit.
+     */
+    ModbusWireTime(uint32_t baudRate, int bitsPerCharacter = 10);
+
+    /**
+     * Returns single character (byte) time.
+     *
+     * @return character time in microseconds
+     */
+    double getCharacterTime() const { return _characterTime; }
+
+    /**
+     * Returns inter-frame silence inserted by FRAMEEND - 3.5 character
+     * times, as required by Modbus RTU.
+     *
+     * @return silence time in microseconds
+     */
+    double getFrameEndTime() const { return 3.5 * _characterTime; }
+
+    /**
+     * Predicts wire time of all subnets in the buffer.
+     *
+     * @param buffer BusList TX buffer - sequence of subnet address, length
+     * and length instructions
+     * @param length buffer length (in words)
+     *
+     * @return per subnet predictions, in buffer order
+     *
+     * @throw std::runtime_error when subnet length is beyond buffer end
+     */
+    std::vector<SubnetWireTime> analyze(const uint16_t* buffer, int32_t length) const;
+
+    /**
+     * Returns the subnet with the longest predicted time.
+     *
+     * @param subnets analyze result
+     *
+     * @return the busiest subnet, nullptr if subnets is empty
+     */
+    static const SubnetWireTime* busiest(const std::vector<SubnetWireTime>& subnets);
+
+private:
+    double _characterTime;
+
+    void _addInstruction(SubnetWireTime& subnet, uint16_t instruction) const;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* MODBUSWIRETIME_H_ */
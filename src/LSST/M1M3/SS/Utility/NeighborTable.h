@@ -0,0 +1,95 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEIGHBORTABLE_H_
+#define NEIGHBORTABLE_H_
+
+#include <vector>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Neighbour graph stored in compressed sparse row (CSR) format. Neighbour
+ * indices of all actuators are stored in a single array, row offsets point
+ * to the first neighbour of each actuator. Replaces per-actuator vectors, so
+ * neighbour sums are calculated in a single streaming pass.
+ */
+class NeighborTable {
+public:
+    NeighborTable() : _offsets(1, 0) {}
+
+    /**
+     * Appends row with neighbours of the next actuator.
+     *
+     * @param neighbors neighbour indices
+     */
+    void addRow(const std::vector<int>& neighbors);
+
+    void clear();
+
+    int getRows() const { return _offsets.size() - 1; }
+    int getCount(int row) const { return _offsets[row + 1] - _offsets[row]; }
+
+    /**
+     * Returns neighbours of the row.
+     *
+     * @param row row (actuator) index
+     *
+     * @return getCount(row) neighbour indices
+     */
+    const int* getRow(int row) const { return _indices.data() + _offsets[row]; }
+
+    /**
+     * Sums values of all neighbours of each row. Neighbours are added in
+     * the order they were stored.
+     *
+     * @param values values indexed by neighbour index
+     * @param initial initial sum of each row
+     * @param sums getRows() calculated sums, can be the initial array
+     */
+    template <typename T>
+    void gatherSum(const float* values, const T* initial, T* sums) const {
+        const int* indices = _indices.data();
+        const int* offsets = _offsets.data();
+        int rows = getRows();
+        for (int row = 0; row < rows; row++) {
+            T sum = initial[row];
+            for (int n = offsets[row]; n < offsets[row + 1]; n++) {
+                sum += values[indices[n]];
+            }
+            sums[row] = sum;
+        }
+    }
+
+private:
+    std::vector<int> _offsets;
+    std::vector<int> _indices;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* NEIGHBORTABLE_H_ */
@@ -0,0 +1,182 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <StageProfiler.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+StageProfiler::StageProfiler(const char* name, size_t window, uint32_t reportInterval)
+        : _name(name), _window(std::max(window, static_cast<size_t>(1))), _reportInterval(reportInterval) {
+    _loops = 0;
+    _current = 0;
+    _scratch.reserve(_window);
+    _reportScratch.reserve(_window);
+    _start = _last = std::chrono::steady_clock::now();
+    _reportPending = false;
+    _stopReporting = false;
+}
+
+StageProfiler::~StageProfiler() {
+    {
+        std::lock_guard<std::mutex> lock(_reportMutex);
+        _stopReporting = true;
+    }
+    _reportCondition.notify_one();
+    if (_reporter.joinable()) {
+        _reporter.join();
+    }
+}
+
+void StageProfiler::start() {
+    _current = 0;
+    _start = _last = std::chrono::steady_clock::now();
+}
+
+void StageProfiler::mark(const char* stage) {
+    auto now = std::chrono::steady_clock::now();
+    addSample(stage, now - _last);
+    _last = now;
+}
+
+void StageProfiler::end() {
+    addSample("total", std::chrono::steady_clock::now() - _start);
+    _loops++;
+    if (_reportInterval > 0 && _loops >= _reportInterval) {
+        requestReport();
+        _loops = 0;
+    }
+}
+
+void StageProfiler::addSample(const char* stage, std::chrono::nanoseconds duration) {
+    size_t index = _findStage(stage);
+    Stage& s = _stages[index];
+    s.samples[s.head] = std::chrono::duration<float, std::micro>(duration).count();
+    s.head = (s.head + 1) % _window;
+    if (s.count < _window) {
+        s.count++;
+    }
+    _current = index + 1;
+}
+
+StageProfiler::Statistics StageProfiler::getStatistics(size_t index) {
+    return _computeStatistics(_stages.at(index), _scratch);
+}
+
+void StageProfiler::report() { _report(_stages, _scratch); }
+
+void StageProfiler::requestReport() {
+    // never block the profiled thread - skip report if the reporting thread is busy
+    std::unique_lock<std::mutex> lock(_reportMutex, std::try_to_lock);
+    if (lock.owns_lock() == false || _reportPending) {
+        return;
+    }
+    _snapshot = _stages;
+    _reportPending = true;
+    if (_reporter.joinable() == false) {
+        _reporter = std::thread(&StageProfiler::_reportingThread, this);
+    }
+    lock.unlock();
+    _reportCondition.notify_one();
+}
+
+size_t StageProfiler::_findStage(const char* stage) {
+    // stages are usually marked in the same order - check expected position first
+    if (_current < _stages.size() &&
+        (_stages[_current].name == stage || strcmp(_stages[_current].name, stage) == 0)) {
+        return _current;
+    }
+    for (size_t i = 0; i < _stages.size(); i++) {
+        if (_stages[i].name == stage || strcmp(_stages[i].name, stage) == 0) {
+            return i;
+        }
+    }
+    _stages.push_back(Stage{stage, std::vector<float>(_window, 0), 0, 0});
+    return _stages.size() - 1;
+}
+
+StageProfiler::Statistics StageProfiler::_computeStatistics(const Stage& stage, std::vector<float>& scratch) {
+    Statistics ret = {stage.name, stage.count, 0, 0, 0, 0};
+    if (stage.count == 0) {
+        return ret;
+    }
+    scratch.assign(stage.samples.begin(), stage.samples.begin() + stage.count);
+
+    auto minMax = std::minmax_element(scratch.begin(), scratch.end());
+    ret.min = *minMax.first;
+    ret.max = *minMax.second;
+
+    double sum = 0;
+    for (auto v : scratch) {
+        sum += v;
+    }
+    ret.mean = sum / stage.count;
+
+    // nearest-rank percentile
+    size_t rank = (stage.count * 99 + 99) / 100 - 1;
+    std::nth_element(scratch.begin(), scratch.begin() + rank, scratch.end());
+    ret.p99 = scratch[rank];
+
+    return ret;
+}
+
+void StageProfiler::_report(const std::vector<Stage>& stages, std::vector<float>& scratch) {
+    SPDLOG_INFO("{} profile (us) - stage: min/mean/p99/max", _name);
+    for (auto& stage : stages) {
+        auto stat = _computeStatistics(stage, scratch);
+        SPDLOG_INFO("{} {:>30}: {:8.1f} {:8.1f} {:8.1f} {:8.1f} ({} samples)", _name, stat.stage, stat.min,
+                    stat.mean, stat.p99, stat.max, stat.samples);
+    }
+}
+
+void StageProfiler::_reportingThread() {
+    // thread inherits real-time scheduling of the profiled thread
+    struct sched_param param;
+    param.sched_priority = 0;
+    pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+
+    std::unique_lock<std::mutex> lock(_reportMutex);
+    while (true) {
+        _reportCondition.wait(lock, [this] { return _reportPending || _stopReporting; });
+        if (_reportPending) {
+            _report(_snapshot, _reportScratch);
+            _reportPending = false;
+        }
+        if (_stopReporting) {
+            return;
+        }
+    }
+}
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
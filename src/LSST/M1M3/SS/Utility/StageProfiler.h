@@ -0,0 +1,188 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef STAGEPROFILER_H_
+#define STAGEPROFILER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Measures duration of sequential stages of a periodic loop. Call start() at
+ * the beginning of the loop, mark(stage) after each stage and end() once the
+ * loop is finished. Duration of the stage is the time elapsed since previous
+ * mark (or start) call. Samples are kept in a rolling window, statistics
+ * (minimum, mean, 99th percentile and maximum) are computed from the window
+ * and logged (info level) every reportInterval loops. Windows are copied on
+ * the profiled thread, statistics are computed and logged by a low priority
+ * reporting thread, so the profiled loop isn't delayed.
+ *
+ * Stage names shall be string literals - only the pointer is stored. Memory
+ * is allocated only when a stage is seen for the first time.
+ *
+ * @code{.cpp}
+ * StageProfiler profiler("runLoop", 500, 500);
+ *
+ * profiler.start();
+ * updateForces();
+ * profiler.mark("updateForces");
+ * readData();
+ * profiler.mark("readData");
+ * profiler.end();
+ * @endcode
+ */
+class StageProfiler {
+public:
+    /**
+     * Statistics of a single stage. All times are in microseconds.
+     */
+    struct Statistics {
+        const char* stage;
+        size_t samples;
+        float min;
+        float mean;
+        float p99;
+        float max;
+    };
+
+    /**
+     * Construct profiler.
+     *
+     * @param name profiler name, used in log records
+     * @param window number of samples kept for each stage
+     * @param reportInterval number of loops between log records. 0 disables logging.
+     */
+    StageProfiler(const char* name, size_t window, uint32_t reportInterval);
+    ~StageProfiler();
+
+    StageProfiler(const StageProfiler&) = delete;
+    StageProfiler& operator=(const StageProfiler&) = delete;
+
+    /**
+     * Starts new loop.
+     */
+    void start();
+
+    /**
+     * Records stage duration - time elapsed since last mark or start call.
+     *
+     * @param stage stage name (string literal)
+     */
+    void mark(const char* stage);
+
+    /**
+     * Finish the loop. Records total loop duration under "total" stage and
+     * requests report if reportInterval loops passed since last report.
+     */
+    void end();
+
+    /**
+     * Adds sample to stage statistics.
+     *
+     * @param stage stage name (string literal)
+     * @param duration stage duration
+     */
+    void addSample(const char* stage, std::chrono::nanoseconds duration);
+
+    /**
+     * Returns number of stages recorded so far.
+     *
+     * @return number of stages
+     */
+    size_t getStageCount() const { return _stages.size(); }
+
+    /**
+     * Returns statistics calculated from samples in the rolling window.
+     *
+     * @param index stage index, 0 to getStageCount() - 1
+     *
+     * @return stage statistics
+     */
+    Statistics getStatistics(size_t index);
+
+    /**
+     * Logs statistics of all stages. Computes statistics on the calling
+     * thread.
+     */
+    void report();
+
+    /**
+     * Copies stage windows and wakes up reporting thread, which computes and
+     * logs statistics. Doesn't block - the request is dropped if the
+     * previous report is still being processed. Reporting thread is started
+     * on the first request, with default (non real-time) scheduling.
+     */
+    void requestReport();
+
+private:
+    struct Stage {
+        const char* name;
+        std::vector<float> samples;
+        size_t head;
+        size_t count;
+    };
+
+    size_t _findStage(const char* stage);
+
+    static Statistics _computeStatistics(const Stage& stage, std::vector<float>& scratch);
+
+    void _report(const std::vector<Stage>& stages, std::vector<float>& scratch);
+
+    void _reportingThread();
+
+    const char* _name;
+    size_t _window;
+    uint32_t _reportInterval;
+    uint32_t _loops;
+
+    std::vector<Stage> _stages;
+    std::vector<float> _scratch;
+    size_t _current;
+
+    std::chrono::steady_clock::time_point _start;
+    std::chrono::steady_clock::time_point _last;
+
+    // windows copied for the reporting thread, guarded by _reportMutex
+    std::vector<Stage> _snapshot;
+    std::vector<float> _reportScratch;
+    bool _reportPending;
+    bool _stopReporting;
+    std::mutex _reportMutex;
+    std::condition_variable _reportCondition;
+    std::thread _reporter;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* STAGEPROFILER_H_ */
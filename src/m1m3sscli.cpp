@@ -29,14 +29,19 @@
 #endif
 
 #include <FPGA.h>
+#include <FPGAAddresses.h>
 #include <ForceActuatorApplicationSettings.h>
+#include <ModbusWireTime.h>
 
 #include <cRIO/FPGACliApp.h>
 #include <cRIO/ElectromechanicalPneumaticILC.h>
 #include <cRIO/PrintILC.h>
 
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <iterator>
+#include <vector>
 
 #include <spdlog/async.h>
 #include <spdlog/spdlog.h>
@@ -49,6 +54,7 @@ class M1M3SScli : public FPGACliApp {
 public:
     M1M3SScli(const char* name, const char* description);
     int setPower(command_vec cmds);
+    int wireTime(command_vec cmds);
 
 protected:
     virtual LSST::cRIO::FPGA* newFPGA(const char* dir) override;
@@ -82,11 +88,18 @@ public:
     void writeCommandFIFO(uint16_t* data, size_t length, uint32_t timeout) override;
     void writeRequestFIFO(uint16_t* data, size_t length, uint32_t timeout) override;
     void readU16ResponseFIFO(uint16_t* data, size_t length, uint32_t timeout) override;
+
+    /**
+     * Last Modbus transmit buffer written to the command FIFO.
+     */
+    std::vector<uint16_t> lastModbusTx;
 };
 
 M1M3SScli::M1M3SScli(const char* name, const char* description) : FPGACliApp(name, description) {
     addCommand("power", std::bind(&M1M3SScli::setPower, this, std::placeholders::_1), "i", NEED_FPGA, "<0|1>",
                "Power off/on ILC bus");
+    addCommand("wire-time", std::bind(&M1M3SScli::wireTime, this, std::placeholders::_1), "i", NEED_FPGA,
+               "[baud rate]", "Predict bus time of the last ILC command. Default baud rate is 2000000");
 
     addILCCommand(
             "calibration",
@@ -139,6 +152,22 @@ int M1M3SScli::setPower(command_vec cmds) {
     return 0;
 }
 
+int M1M3SScli::wireTime(command_vec cmds) {
+    uint32_t baudRate = cmds.empty() ? 2000000 : std::stoul(cmds[0]);
+    auto& tx = dynamic_cast<PrintSSFPGA*>(getFPGA())->lastModbusTx;
+    if (tx.empty()) {
+        std::cerr << "No ILC command was sent yet." << std::endl;
+        return -1;
+    }
+    ModbusWireTime wireTime(baudRate);
+    for (auto& s : wireTime.analyze(tx.data(), tx.size())) {
+        std::cout << "Subnet " << s.subnet + 1 << ": " << s.frames << " frames, " << s.txBytes
+                  << " bytes, TX " << std::setprecision(1) << std::fixed << s.txTime << " us, wait "
+                  << s.waitTime << " us, total " << s.total() << " us" << std::endl;
+    }
+    return 0;
+}
+
 LSST::cRIO::FPGA* M1M3SScli::newFPGA(const char* dir) { return new PrintSSFPGA(); }
 
 constexpr int ILC_BUS = 5;
@@ -318,6 +347,11 @@ void _printBuffer(std::string prefix, uint16_t* buf, size_t len) {
 
 void PrintSSFPGA::writeCommandFIFO(uint16_t* data, size_t length, uint32_t timeout) {
     _printBuffer("C> ", data, length);
+    auto subnetBegin = std::begin(FPGAAddresses::ModbusSubnetsTx);
+    auto subnetEnd = std::end(FPGAAddresses::ModbusSubnetsTx);
+    if (length > 2 && std::find(subnetBegin, subnetEnd, data[0]) != subnetEnd) {
+        lastModbusTx.assign(data, data + length);
+    }
     FPGAClass::writeCommandFIFO(data, length, timeout);
 }
 
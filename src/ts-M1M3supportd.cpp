@@ -31,6 +31,7 @@
 #include <Model.h>
 #include <OuterLoopClockThread.h>
 #include <PPSThread.h>
+#include <RealTime.h>
 #include <SAL_MTM1M3.h>
 #include <SAL_MTMount.h>
 #include <SettingReader.h>
@@ -186,6 +187,10 @@ void runFPGAs(std::shared_ptr<SAL_MTM1M3> m1m3SAL, std::shared_ptr<SAL_MTMount>
     OuterLoopClockThread outerLoopClockThread;
     SPDLOG_INFO("Main: Creating pps thread");
     PPSThread ppsThread;
+    SPDLOG_INFO("Main: Loading real-time settings");
+    RealTimeApplicationSettings* realTimeSettings =
+            SettingReader::instance().loadRealTimeApplicationSettings();
+    RealTime::lockMemory(realTimeSettings);
     SPDLOG_INFO("Main: Queuing EnterControl command");
     ControllerThread::get().enqueue(new EnterControlCommand());
 
@@ -195,14 +200,26 @@ void runFPGAs(std::shared_ptr<SAL_MTM1M3> m1m3SAL, std::shared_ptr<SAL_MTMount>
 
     try {
         SPDLOG_INFO("Main: Starting pps thread");
-        std::thread pps([&ppsThread] { ppsThread.run(); });
+        std::thread pps([&ppsThread, realTimeSettings] {
+            RealTime::configureThread("PPS", realTimeSettings);
+            ppsThread.run();
+        });
         std::this_thread::sleep_for(1500ms);
         SPDLOG_INFO("Main: Starting subscriber thread");
-        std::thread subscriber([&subscriberThread] { subscriberThread.run(); });
+        std::thread subscriber([&subscriberThread, realTimeSettings] {
+            RealTime::configureThread("Subscriber", realTimeSettings);
+            subscriberThread.run();
+        });
         SPDLOG_INFO("Main: Starting controller thread");
-        std::thread controller([] { ControllerThread::get().run(); });
+        std::thread controller([realTimeSettings] {
+            RealTime::configureThread("Controller", realTimeSettings);
+            ControllerThread::get().run();
+        });
         SPDLOG_INFO("Main: Starting outer loop clock thread");
-        std::thread outerLoopClock([&outerLoopClockThread] { outerLoopClockThread.run(); });
+        std::thread outerLoopClock([&outerLoopClockThread, realTimeSettings] {
+            RealTime::configureThread("OuterLoopClock", realTimeSettings);
+            outerLoopClockThread.run();
+        });
 
         SPDLOG_INFO("Main: Waiting for ExitControl");
 
@@ -0,0 +1,257 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Benchmarks bus lists.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <ActiveBusList.h>
+#include <ChangeILCModeBusList.h>
+#include <CRC.h>
+#include <FreezeSensorBusList.h>
+#include <ILCMessageFactory.h>
+#include <ILCResponseParser.h>
+#include <ILCSubnetData.h>
+#include <M1M3SSPublisher.h>
+#include <Model.h>
+#include <ModbusBuffer.h>
+#include <RaisedBusList.h>
+#include <ReadBoostValveDCAGainBusList.h>
+#include <ReadCalibrationBusList.h>
+#include <ReportADCScanRateBusList.h>
+#include <ReportDCAIDBusList.h>
+#include <ReportDCAStatusBusList.h>
+#include <ReportServerIDBusList.h>
+#include <ReportServerStatusBusList.h>
+#include <ResetBustList.h>
+#include <SetADCChanneOffsetAndSensitivityBusList.h>
+#include <SetADCScanRateBusList.h>
+#include <SetBoostValveDCAGainBusList.h>
+#include <SettingReader.h>
+
+#include <SAL_MTM1M3.h>
+
+using namespace LSST::M1M3::SS;
+
+// regression thresholds - 10 %, 1 % and 5 % of the 20 ms outer loop period.
+// Generous enough to pass on a loaded development machine, tight enough to
+// catch changes in complexity of the encoding path
+constexpr double BUILD_BUFFER_LIMIT_NS = 2000000;
+constexpr double UPDATE_LIMIT_NS = 200000;
+constexpr double PARSE_LIMIT_NS = 1000000;
+
+/**
+ * Loads Default settings and constructs all bus lists the ILC class
+ * constructs.
+ */
+class BusListsFixture {
+public:
+    BusListsFixture() {
+        M1M3SSPublisher::get().setSAL(std::make_shared<SAL_MTM1M3>());
+        SettingReader::instance().setRootPath("../SettingFiles");
+        Model::get().loadSettings("Default");
+
+        SettingReader& reader = SettingReader::instance();
+        subnetData.reset(new ILCSubnetData(reader.getForceActuatorApplicationSettings(),
+                                           reader.getForceActuatorSettings(),
+                                           reader.loadHardpointActuatorApplicationSettings(),
+                                           reader.loadHardpointMonitorApplicationSettings()));
+        messageFactory.reset(new ILCMessageFactory(reader.loadILCApplicationSettings()));
+        responseParser.reset(new ILCResponseParser(reader.getForceActuatorSettings(),
+                                                   reader.getHardpointActuatorSettings(), subnetData.get(),
+                                                   Model::get().getSafetyController()));
+
+        ILCSubnetData* sd = subnetData.get();
+        ILCMessageFactory* mf = messageFactory.get();
+        busLists.emplace_back(new SetADCChanneOffsetAndSensitivityBusList(sd, mf));
+        busLists.emplace_back(new SetADCScanRateBusList(sd, mf));
+        busLists.emplace_back(new SetBoostValveDCAGainBusList(sd, mf));
+        busLists.emplace_back(new ResetBustList(sd, mf));
+        busLists.emplace_back(new ReportServerIDBusList(sd, mf));
+        busLists.emplace_back(new ReportServerStatusBusList(sd, mf));
+        busLists.emplace_back(new ReportADCScanRateBusList(sd, mf));
+        busLists.emplace_back(new ReadCalibrationBusList(sd, mf));
+        busLists.emplace_back(new ReadBoostValveDCAGainBusList(sd, mf));
+        busLists.emplace_back(new ReportDCAIDBusList(sd, mf));
+        busLists.emplace_back(new ReportDCAStatusBusList(sd, mf));
+        busLists.emplace_back(new ChangeILCModeBusList(sd, mf, ILCModes::Disabled, ILCModes::Enabled));
+        busLists.emplace_back(new ChangeILCModeBusList(sd, mf, ILCModes::Enabled, ILCModes::Enabled));
+        busLists.emplace_back(new ChangeILCModeBusList(sd, mf, ILCModes::Standby, ILCModes::Standby));
+        busLists.emplace_back(new ChangeILCModeBusList(sd, mf, ILCModes::ClearFaults, ILCModes::ClearFaults));
+        busLists.emplace_back(new FreezeSensorBusList(sd, mf));
+
+        raised = new RaisedBusList(sd, mf);
+        busLists.emplace_back(raised);
+        active = new ActiveBusList(sd, mf);
+        busLists.emplace_back(active);
+
+        for (auto& bl : busLists) {
+            bl->buildBuffer();
+        }
+
+        for (int subnet = 0; subnet < SUBNET_COUNT; subnet++) {
+            forceDemandResponses[subnet] = forceDemandResponse(subnet);
+        }
+    }
+
+    /**
+     * Synthesize subnet response buffer - global timestamp followed by
+     * force demand responses of all force actuators on the subnet. Status
+     * matches the current broadcast counter and all forces are zero, so no
+     * warnings are triggered.
+     */
+    std::vector<uint16_t> forceDemandResponse(int subnetIndex) {
+        uint8_t status = M1M3SSPublisher::get().getOuterLoopData()->broadcastCounter << 4;
+        std::vector<uint16_t> buffer = {0, 0, 0, 0};
+        for (int faIndex = 0; faIndex < subnetData->getFACount(subnetIndex); faIndex++) {
+            uint8_t address = subnetData->getFAAddresses(subnetIndex)[faIndex];
+            std::vector<uint8_t> data = {address, 75, status, 0, 0, 0, 0};
+            if (address > 16) {
+                data.insert(data.end(), 4, 0);
+            }
+            uint16_t crc = CRC::modbus(data.data(), 0, data.size());
+            data.push_back(crc & 0xFF);
+            data.push_back(crc >> 8);
+            for (auto d : data) {
+                buffer.push_back(0x9000 | (d << 1));
+            }
+            for (int i = 0; i < 8; i++) {
+                buffer.push_back(0xB000 | i);
+            }
+            buffer.push_back(0xA000);
+        }
+        return buffer;
+    }
+
+    /**
+     * Parses synthesized force demand responses of all subnets.
+     */
+    void parseAll() {
+        for (int subnet = 0; subnet < SUBNET_COUNT; subnet++) {
+            auto& response = forceDemandResponses[subnet];
+            if (response.size() <= 4) {
+                continue;
+            }
+            for (size_t i = 0; i < response.size(); i++) {
+                rxBuffer.set(i, response[i]);
+            }
+            rxBuffer.setIndex(0);
+            rxBuffer.setLength(response.size());
+            responseParser->parse(&rxBuffer, subnet + 1);
+        }
+    }
+
+    std::unique_ptr<ILCSubnetData> subnetData;
+    std::unique_ptr<ILCMessageFactory> messageFactory;
+    std::unique_ptr<ILCResponseParser> responseParser;
+    std::vector<std::unique_ptr<BusList>> busLists;
+    RaisedBusList* raised;
+    ActiveBusList* active;
+
+    std::vector<uint16_t> forceDemandResponses[SUBNET_COUNT];
+    ModbusBuffer rxBuffer;
+};
+
+/**
+ * Runs func cycles times, prints average time per call.
+ *
+ * @return average time per func call in ns
+ */
+template <typename F>
+static double nsPerCycle(const char* name, int cycles, F func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < cycles; i++) {
+        func();
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    double ret = elapsed.count() / cycles;
+    std::cout << name << ": " << std::fixed << ret << " ns/cycle" << std::endl;
+    return ret;
+}
+
+TEST_CASE("Build all bus lists", "[BusLists]") {
+    BusListsFixture fixture;
+
+    for (auto& bl : fixture.busLists) {
+        REQUIRE(bl->getLength() > 0);
+    }
+
+    SECTION("Parse force demand responses") {
+        auto forceActuatorData = M1M3SSPublisher::get().getForceActuatorData();
+        for (int i = 0; i < FA_COUNT; i++) {
+            forceActuatorData->primaryCylinderForce[i] = NAN;
+        }
+
+        fixture.parseAll();
+
+        for (int i = 0; i < FA_COUNT; i++) {
+            CHECK(forceActuatorData->primaryCylinderForce[i] == 0);
+        }
+    }
+}
+
+// Run with ./test_BusLists "[benchmark]"
+TEST_CASE("Bus lists encoding and parsing", "[.][benchmark]") {
+    BusListsFixture fixture;
+
+    BENCHMARK("Active buildBuffer") {
+        fixture.active->buildBuffer();
+        return fixture.active->getLength();
+    };
+
+    BENCHMARK("Active update") {
+        fixture.active->update();
+        return fixture.active->getLength();
+    };
+
+    BENCHMARK("Raised update") {
+        fixture.raised->update();
+        return fixture.raised->getLength();
+    };
+
+    BENCHMARK("Parse force demand responses") {
+        fixture.parseAll();
+        return fixture.rxBuffer.getIndex();
+    };
+
+    const int cycles = 1000;
+
+    double buildBuffer = nsPerCycle("All lists buildBuffer", cycles, [&fixture]() {
+        for (auto& bl : fixture.busLists) {
+            bl->buildBuffer();
+        }
+    });
+    double activeUpdate = nsPerCycle("Active update", cycles, [&fixture]() { fixture.active->update(); });
+    double raisedUpdate = nsPerCycle("Raised update", cycles, [&fixture]() { fixture.raised->update(); });
+    double parse = nsPerCycle("Parse responses", cycles, [&fixture]() { fixture.parseAll(); });
+
+    CHECK(buildBuffer < BUILD_BUFFER_LIMIT_NS);
+    CHECK(activeUpdate < UPDATE_LIMIT_NS);
+    CHECK(raisedUpdate < UPDATE_LIMIT_NS);
+    CHECK(parse < PARSE_LIMIT_NS);
+}
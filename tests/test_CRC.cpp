@@ -0,0 +1,151 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <random>
+#include <vector>
+
+#include <CRC.h>
+#include <ModbusBuffer.h>
+
+using namespace LSST::M1M3::SS;
+
+/**
+ * Reference bit-by-bit implementation, as used before table driven CRC.
+ */
+static uint16_t bitwiseCRC(const std::vector<uint8_t>& data) {
+    uint16_t crc = 0xFFFF;
+    for (auto i : data) {
+        crc = crc ^ (uint16_t(i));
+        for (int j = 0; j < 8; j++) {
+            if (crc & 0x0001) {
+                crc = crc >> 1;
+                crc = crc ^ 0xA001;
+            } else {
+                crc = crc >> 1;
+            }
+        }
+    }
+    return crc;
+}
+
+TEST_CASE("Known values", "[CRC]") {
+    uint8_t shortData[] = {123, 17};
+    REQUIRE(CRC::modbus(shortData, 0, 2) == 0x4ce3);
+
+    std::vector<uint8_t> data = {0x81, 0x11, 0x10, 0x12, 0x34, 0x56, 0x78, 0x90, 0xAA, 0xFF,
+                                 0xBB, 0xCC, 0xDD, 0xEE, 0x11, 0x53, 0x74, 0x61, 0x72};
+    REQUIRE(CRC::modbus(data.data(), 0, data.size()) == 0x9FA7);
+    REQUIRE(bitwiseCRC(data) == 0x9FA7);
+
+    REQUIRE(CRC::modbus(data.data(), 0, 0) == 0xFFFF);
+}
+
+TEST_CASE("Random data matches bitwise implementation", "[CRC]") {
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> byteDist(0, 255);
+
+    for (size_t len = 0; len < 300; len++) {
+        std::vector<uint8_t> data(len);
+        for (auto& d : data) d = byteDist(gen);
+
+        uint16_t expected = bitwiseCRC(data);
+
+        REQUIRE(CRC::modbus(data.data(), 0, len) == expected);
+        REQUIRE(ModbusBuffer::calculateCRC(data) == expected);
+
+        std::vector<uint16_t> words(data.begin(), data.end());
+        REQUIRE(CRC::modbus(words.data(), 0, len) == expected);
+
+        ModbusBuffer mbuf;
+        for (auto d : data) mbuf.writeU8(d);
+        REQUIRE(CRC::modbusFIFO(mbuf.getBuffer(), len) == expected);
+        REQUIRE(mbuf.calculateCRC(len) == expected);
+    }
+}
+
+TEST_CASE("Offset", "[CRC]") {
+    std::vector<uint8_t> data = {0xFF, 0xFF, 123, 17};
+    REQUIRE(CRC::modbus(data.data(), 2, 2) == 0x4ce3);
+}
+
+TEST_CASE("Patch CRC", "[CRC]") {
+    std::mt19937 gen(5678);
+    std::uniform_int_distribution<int> byteDist(0, 255);
+
+    std::vector<uint8_t> data(244);
+    for (auto& d : data) d = byteDist(gen);
+
+    ModbusCRCPatcher patcher(data.size());
+    REQUIRE(patcher.getLength() == 244);
+
+    uint16_t crc = CRC::modbus(data.data(), 0, data.size());
+
+    std::uniform_int_distribution<size_t> posDist(0, data.size() - 1);
+    for (int i = 0; i < 1000; i++) {
+        size_t pos = posDist(gen);
+        uint8_t newData = byteDist(gen);
+        crc = patcher.patch(crc, pos, data[pos], newData);
+        data[pos] = newData;
+        REQUIRE(crc == CRC::modbus(data.data(), 0, data.size()));
+    }
+
+    // unchanged byte
+    REQUIRE(patcher.patch(crc, 10, data[10], data[10]) == crc);
+}
+
+// Run with ./test_CRC "[benchmark]"
+TEST_CASE("Response buffer CRC", "[.][benchmark]") {
+    // no recorded response buffer is available, synthesize a full cycle -
+    // 5 subnets with 12 byte force actuator frames for 156 ILCs
+    std::mt19937 gen(4321);
+    std::uniform_int_distribution<int> byteDist(0, 255);
+
+    const int frameLength = 12;
+    const int frames = 156;
+
+    ModbusBuffer mbuf;
+    for (int i = 0; i < frameLength * frames; i++) {
+        mbuf.writeU8(byteDist(gen));
+    }
+
+    BENCHMARK("Copy + bitwise") {
+        uint16_t ret = 0;
+        for (int f = 0; f < frames; f++) {
+            mbuf.setIndex((f + 1) * frameLength);
+            ret ^= bitwiseCRC(mbuf.getReadData(frameLength));
+        }
+        return ret;
+    };
+
+    BENCHMARK("FIFO table") {
+        uint16_t ret = 0;
+        for (int f = 0; f < frames; f++) {
+            mbuf.setIndex((f + 1) * frameLength);
+            ret ^= mbuf.calculateCRC(frameLength);
+        }
+        return ret;
+    };
+}
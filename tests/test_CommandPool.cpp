@@ -0,0 +1,73 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests CommandPool class.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Command.h>
+#include <CommandPool.h>
+
+#include <vector>
+
+using namespace LSST::M1M3::SS;
+
+class BigCommand : public Command {
+public:
+    BigCommand() : Command(1) {}
+    char payload[2000];
+};
+
+TEST_CASE("Slot reuse", "[CommandPool]") {
+    Command* first = new Command(1);
+    delete first;
+    Command* second = new Command(2);
+    REQUIRE(second->getCommandID() == 2);
+    delete second;
+
+    uint64_t heap = CommandPool::get().getHeapAllocations();
+    for (int i = 0; i < 1000; i++) {
+        delete new Command(i);
+        delete new BigCommand();
+    }
+    REQUIRE(CommandPool::get().getHeapAllocations() == heap);
+}
+
+TEST_CASE("Heap fallback", "[CommandPool]") {
+    uint64_t heap = CommandPool::get().getHeapAllocations();
+    std::vector<Command*> commands;
+    for (int i = 0; i < 20; i++) {
+        commands.push_back(new BigCommand());
+    }
+    REQUIRE(CommandPool::get().getHeapAllocations() == heap + 12);
+    for (auto c : commands) {
+        delete c;
+    }
+
+    commands.clear();
+    for (int i = 0; i < 8; i++) {
+        commands.push_back(new BigCommand());
+    }
+    REQUIRE(CommandPool::get().getHeapAllocations() == heap + 12);
+    for (auto c : commands) {
+        delete c;
+    }
+}
@@ -0,0 +1,296 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests ForceComponent.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cmath>
+#include <random>
+
+#include <ForceComponent.h>
+
+using namespace LSST::M1M3::SS;
+
+/**
+ * Force component exposing its forces, counting post actions calls.
+ */
+class TestForceComponent : public ForceComponent {
+public:
+    TestForceComponent(const ForceComponentSettings& settings) : ForceComponent("Test", settings) {}
+
+    void setTarget(int zIndex, float x, float y, float z) {
+        if (zIndex < FA_X_COUNT) {
+            xTarget[zIndex] = x;
+        }
+        if (zIndex < FA_Y_COUNT) {
+            yTarget[zIndex] = y;
+        }
+        zTarget[zIndex] = z;
+    }
+
+    float getX(int i) { return xCurrent[i]; }
+    float getY(int i) { return yCurrent[i]; }
+    float getZ(int i) { return zCurrent[i]; }
+
+    /**
+     * Ramp as implemented before X, Y and Z forces were stored contiguously -
+     * per-axis branches in a loop over all force actuators. Used as
+     * reference in benchmark.
+     */
+    void perAxisUpdate(float maxRateOfChange) {
+        float largestDelta = 0.0;
+        for (int i = 0; i < FA_COUNT; ++i) {
+            if (i < FA_X_COUNT) {
+                xOffset[i] = xTarget[i] - xCurrent[i];
+                if (std::abs(xOffset[i]) > largestDelta) {
+                    largestDelta = std::abs(xOffset[i]);
+                }
+            }
+
+            if (i < FA_Y_COUNT) {
+                yOffset[i] = yTarget[i] - yCurrent[i];
+                if (std::abs(yOffset[i]) > largestDelta) {
+                    largestDelta = std::abs(yOffset[i]);
+                }
+            }
+
+            zOffset[i] = zTarget[i] - zCurrent[i];
+            if (std::abs(zOffset[i]) > largestDelta) {
+                largestDelta = std::abs(zOffset[i]);
+            }
+        }
+        float scalar = largestDelta / maxRateOfChange;
+        if (scalar > 1) {
+            for (int i = 0; i < FA_COUNT; ++i) {
+                if (i < FA_X_COUNT) {
+                    xOffset[i] /= scalar;
+                    xCurrent[i] += xOffset[i];
+                }
+
+                if (i < FA_Y_COUNT) {
+                    yOffset[i] /= scalar;
+                    yCurrent[i] += yOffset[i];
+                }
+
+                zOffset[i] /= scalar;
+                zCurrent[i] += zOffset[i];
+            }
+        }
+    }
+
+    int enableDisableActions = 0;
+    int updateActions = 0;
+    int unchangedActions = 0;
+
+protected:
+    void postEnableDisableActions() override { enableDisableActions++; }
+    void postUpdateActions() override { updateActions++; }
+    void postUnchangedActions() override { unchangedActions++; }
+};
+
+static ForceComponentSettings componentSettings() {
+    ForceComponentSettings settings;
+    settings.MaxRateOfChange = 10;
+    settings.NearZeroValue = 0.5;
+    return settings;
+}
+
+TEST_CASE("Ramp to target", "[ForceComponent]") {
+    TestForceComponent component(componentSettings());
+    component.enable();
+
+    // the largest delta is on Z axis - other forces are scaled
+    component.setTarget(0, 20, 0, -40);
+    component.setTarget(155, 0, 0, 4);
+
+    component.update();
+    CHECK(component.getX(0) == 5);
+    CHECK(component.getZ(0) == -10);
+    CHECK(component.getZ(155) == 1);
+    CHECK(component.updateActions == 1);
+
+    for (int i = 0; i < 3; i++) {
+        component.update();
+    }
+    CHECK(component.getX(0) == 20);
+    CHECK(component.getZ(0) == -40);
+    CHECK(component.getZ(155) == 4);
+
+    // within rate of change - target is set
+    component.setTarget(99, 0, 3.3, 0);
+    component.update();
+    CHECK(component.getY(99) == 3.3f);
+    CHECK(component.updateActions == 5);
+}
+
+TEST_CASE("Disable drives to zero", "[ForceComponent]") {
+    TestForceComponent component(componentSettings());
+    component.enable();
+    component.setTarget(11, 15, 0, 0);
+    component.update();
+    component.update();
+    REQUIRE(component.getX(11) == 15);
+
+    component.disable();
+    REQUIRE(component.isDisabling());
+    component.update();
+    CHECK(component.getX(11) == 5);
+    CHECK(component.isDisabling());
+
+    component.update();
+    CHECK(component.getX(11) == 0);
+    CHECK(component.isDisabling());
+
+    // all forces near zero - disabled
+    component.update();
+    CHECK_FALSE(component.isDisabling());
+    CHECK_FALSE(component.isEnabled());
+
+    // disabled component isn't updated
+    int updateActions = component.updateActions;
+    component.update();
+    CHECK(component.updateActions == updateActions);
+}
+
+TEST_CASE("Converged component is skipped", "[ForceComponent]") {
+    TestForceComponent component(componentSettings());
+    component.enable();
+
+    // the first update always runs post update actions
+    component.update();
+    CHECK(component.updateActions == 1);
+    CHECK(component.unchangedActions == 0);
+
+    component.update();
+    CHECK(component.updateActions == 1);
+    CHECK(component.unchangedActions == 1);
+
+    component.setTarget(42, 0, 0, 15);
+    component.update();
+    component.update();
+    REQUIRE(component.getZ(42) == 15);
+    CHECK(component.updateActions == 3);
+
+    // same target written again - nothing changes
+    component.setTarget(42, 0, 0, 15);
+    component.update();
+    CHECK(component.updateActions == 3);
+    CHECK(component.unchangedActions == 2);
+
+    // disabling component isn't at its zero target
+    component.disable();
+    component.update();
+    CHECK(component.getZ(42) == 5);
+    CHECK(component.updateActions == 4);
+
+    component.reset();
+
+    // current equals zero target after reset and enable, but forces have to
+    // be processed again
+    int updateActions = component.updateActions;
+    int unchangedActions = component.unchangedActions;
+    component.enable();
+    component.update();
+    CHECK(component.updateActions == updateActions + 1);
+    CHECK(component.unchangedActions == unchangedActions);
+
+    component.update();
+    CHECK(component.updateActions == updateActions + 1);
+    CHECK(component.unchangedActions == unchangedActions + 1);
+}
+
+TEST_CASE("Matches per-axis update", "[ForceComponent]") {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> forceDist(-500, 500);
+
+    TestForceComponent fused(componentSettings());
+    TestForceComponent reference(componentSettings());
+    fused.enable();
+    reference.enable();
+
+    for (int i = 0; i < FA_COUNT; i++) {
+        float x = forceDist(gen);
+        float y = forceDist(gen);
+        float z = forceDist(gen);
+        fused.setTarget(i, x, y, z);
+        reference.setTarget(i, x, y, z);
+    }
+
+    for (int cycle = 0; cycle < 10; cycle++) {
+        fused.update();
+        reference.perAxisUpdate(componentSettings().MaxRateOfChange);
+        for (int i = 0; i < FA_COUNT; i++) {
+            if (i < FA_X_COUNT) {
+                REQUIRE(fused.getX(i) == reference.getX(i));
+            }
+            if (i < FA_Y_COUNT) {
+                REQUIRE(fused.getY(i) == reference.getY(i));
+            }
+            REQUIRE(fused.getZ(i) == reference.getZ(i));
+        }
+    }
+}
+
+// Run with ./test_ForceComponent "[benchmark]"
+TEST_CASE("Force component ramp", "[.][benchmark]") {
+    std::mt19937 gen(4321);
+    std::uniform_real_distribution<float> forceDist(-5000, 5000);
+
+    // slow rate of change, so all cycles scale offsets
+    ForceComponentSettings settings = componentSettings();
+    settings.MaxRateOfChange = 0.001;
+
+    TestForceComponent component(settings);
+    component.enable();
+
+    auto setTargets = [&]() {
+        for (int i = 0; i < FA_COUNT; i++) {
+            component.setTarget(i, forceDist(gen), forceDist(gen), forceDist(gen));
+        }
+    };
+
+    setTargets();
+    BENCHMARK("Per-axis passes") {
+        component.perAxisUpdate(settings.MaxRateOfChange);
+        return component.getZ(0);
+    };
+
+    setTargets();
+    BENCHMARK("Contiguous single sweep") {
+        component.update();
+        return component.getZ(0);
+    };
+
+    TestForceComponent converged(componentSettings());
+    converged.enable();
+    for (int i = 0; i < FA_COUNT; i++) {
+        converged.setTarget(i, forceDist(gen), forceDist(gen), forceDist(gen));
+    }
+    while (converged.unchangedActions == 0) {
+        converged.update();
+    }
+    BENCHMARK("Converged") {
+        converged.update();
+        return converged.getZ(0);
+    };
+}
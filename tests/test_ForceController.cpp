@@ -27,6 +27,7 @@
 
 #include <ForceController.h>
 #include <Model.h>
+#include <OffsetForceComponent.h>
 #include <SettingReader.h>
 #include <StateTypes.h>
 
@@ -224,4 +225,35 @@ TEST_CASE("M1M3 ForceController tests", "[M1M3]") {
         CHECK(Model::get().getSafetyController()->checkSafety(States::ActiveState) ==
               States::LoweringFaultState);
     }
+
+    SECTION("Offset forces are fully cleared") {
+        OffsetForceComponent offsetForceComponent(
+                SettingReader::instance().getForceActuatorApplicationSettings(),
+                SettingReader::instance().getForceActuatorSettings());
+        offsetForceComponent.enable();
+        for (int i = 0; i < FA_COUNT; i++) {
+            if (i < FA_X_COUNT) {
+                offsetForceComponent.applyActuatorOffset('X', i, 10);
+            }
+            if (i < FA_Y_COUNT) {
+                offsetForceComponent.applyActuatorOffset('Y', i, 10);
+            }
+            offsetForceComponent.applyActuatorOffset('Z', i, 10);
+        }
+
+        offsetForceComponent.zeroOffsetForces();
+        offsetForceComponent.update();
+
+        MTM1M3_logevent_appliedOffsetForcesC *appliedOffsetForces =
+                M1M3SSPublisher::get().getEventAppliedOffsetForces();
+        for (int i = 0; i < FA_COUNT; i++) {
+            if (i < FA_X_COUNT) {
+                CHECK(appliedOffsetForces->xForces[i] == 0);
+            }
+            if (i < FA_Y_COUNT) {
+                CHECK(appliedOffsetForces->yForces[i] == 0);
+            }
+            CHECK(appliedOffsetForces->zForces[i] == 0);
+        }
+    }
 }
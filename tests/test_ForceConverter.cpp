@@ -0,0 +1,195 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests ForceConverter kernels.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+#include <CoefficientTable.h>
+#include <ForceActuatorSettings.h>
+#include <ForceConverter.h>
+
+using namespace LSST::M1M3::SS;
+using Catch::Approx;
+
+/**
+ * Fills polynomial and matrix tables with random coefficients. Polynomial
+ * coefficients decrease with order, similar to elevation tables.
+ */
+static void fillTables(ForceActuatorSettings& settings) {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> dist(-1, 1);
+
+    auto polynomial = [&](std::vector<float>& table) {
+        const float scale[] = {1e-8, 1e-6, 1e-3, 1e-2, 30, 100};
+        table.resize(FA_COUNT * 6);
+        for (size_t i = 0; i < table.size(); i++) {
+            table[i] = dist(gen) * scale[i % 6];
+        }
+    };
+    auto matrix = [&](std::vector<float>& table) {
+        table.resize(FA_COUNT * 3);
+        for (auto& v : table) {
+            v = dist(gen) * 1000;
+        }
+    };
+
+    matrix(settings.AccelerationXTable);
+    matrix(settings.AccelerationYTable);
+    matrix(settings.AccelerationZTable);
+    polynomial(settings.AzimuthXTable);
+    polynomial(settings.AzimuthYTable);
+    polynomial(settings.AzimuthZTable);
+    polynomial(settings.ElevationXTable);
+    polynomial(settings.ElevationYTable);
+    polynomial(settings.ElevationZTable);
+    polynomial(settings.ThermalXTable);
+    polynomial(settings.ThermalYTable);
+    polynomial(settings.ThermalZTable);
+    matrix(settings.VelocityXTable);
+    matrix(settings.VelocityYTable);
+    matrix(settings.VelocityZTable);
+    matrix(settings.VelocityXZTable);
+    matrix(settings.VelocityYZTable);
+}
+
+static void requireEqual(const DistributedForces& a, const DistributedForces& b) {
+    for (int i = 0; i < FA_COUNT; i++) {
+        REQUIRE(a.XForces[i] == b.XForces[i]);
+        REQUIRE(a.YForces[i] == b.YForces[i]);
+        REQUIRE(a.ZForces[i] == b.ZForces[i]);
+    }
+}
+
+/**
+ * Horner's scheme rounds differently. Allowed error is relative to the
+ * largest polynomial term, as terms can cancel each other.
+ */
+static void requireClose(const std::vector<float>& table, float value, const float* scalar,
+                         const float* horner) {
+    for (int i = 0; i < FA_COUNT; i++) {
+        float largest = 0;
+        for (int c = 0; c < 6; c++) {
+            largest = std::max(largest, std::abs(table[i * 6 + c] * std::pow(value, 5.0f - c)));
+        }
+        REQUIRE(horner[i] == Approx(scalar[i]).margin(largest * 1e-5));
+    }
+}
+
+TEST_CASE("Transpose table", "[CoefficientTable]") {
+    CoefficientTable table;
+    REQUIRE(table.empty());
+
+    table.set({1, 2, 3, 4, 5, 6}, 3);
+    REQUIRE(table.getRows() == 2);
+    REQUIRE(table.getColumns() == 3);
+    CHECK(table.getColumn(0)[0] == 1);
+    CHECK(table.getColumn(0)[1] == 4);
+    CHECK(table.getColumn(1)[0] == 2);
+    CHECK(table.getColumn(2)[1] == 6);
+
+    REQUIRE_THROWS_AS(table.set({1, 2, 3, 4}, 3), std::invalid_argument);
+}
+
+TEST_CASE("Transposed kernels", "[ForceConverter]") {
+    ForceActuatorSettings settings;
+    fillTables(settings);
+
+    ForceConverter::Kernel kernel = ForceConverter::getKernel();
+
+    SECTION("No transposed tables - scalar fallback") {
+        ForceConverter::setKernel(ForceConverter::SCALAR);
+        auto scalar = ForceConverter::calculateForceFromElevationAngle(&settings, 45);
+        ForceConverter::setKernel(ForceConverter::HORNER);
+        requireEqual(scalar, ForceConverter::calculateForceFromElevationAngle(&settings, 45));
+    }
+
+    settings.transposeTables();
+
+    SECTION("Bit-for-bit identical matrix products") {
+        for (auto kernel : {ForceConverter::TRANSPOSED, ForceConverter::HORNER}) {
+            for (float v : {-0.5f, 0.0f, 0.013f, 1.7f}) {
+                ForceConverter::setKernel(ForceConverter::SCALAR);
+                auto acc = ForceConverter::calculateForceFromAngularAcceleration(&settings, v, -v, 2 * v);
+                auto vel = ForceConverter::calculateForceFromAngularVelocity(&settings, v, 3 * v, -v);
+                ForceConverter::setKernel(kernel);
+                requireEqual(acc,
+                             ForceConverter::calculateForceFromAngularAcceleration(&settings, v, -v, 2 * v));
+                requireEqual(vel, ForceConverter::calculateForceFromAngularVelocity(&settings, v, 3 * v, -v));
+            }
+        }
+    }
+
+    SECTION("Bit-for-bit identical transposed polynomials") {
+        for (float v : {-12.5f, 0.0f, 1.0f, 22.3f, 45.0f, 90.0f, 181.2f}) {
+            ForceConverter::setKernel(ForceConverter::SCALAR);
+            auto azimuth = ForceConverter::calculateForceFromAzimuthAngle(&settings, v);
+            auto elevation = ForceConverter::calculateForceFromElevationAngle(&settings, v);
+            auto thermal = ForceConverter::calculateForceFromTemperature(&settings, v);
+            ForceConverter::setKernel(ForceConverter::TRANSPOSED);
+            requireEqual(azimuth, ForceConverter::calculateForceFromAzimuthAngle(&settings, v));
+            requireEqual(elevation, ForceConverter::calculateForceFromElevationAngle(&settings, v));
+            requireEqual(thermal, ForceConverter::calculateForceFromTemperature(&settings, v));
+        }
+    }
+
+    SECTION("Horner polynomials within tolerance") {
+        for (float v : {-12.5f, 0.0f, 1.0f, 22.3f, 45.0f, 90.0f, 181.2f}) {
+            ForceConverter::setKernel(ForceConverter::SCALAR);
+            auto scalar = ForceConverter::calculateForceFromElevationAngle(&settings, v);
+            ForceConverter::setKernel(ForceConverter::HORNER);
+            auto horner = ForceConverter::calculateForceFromElevationAngle(&settings, v);
+            requireClose(settings.ElevationXTable, v, scalar.XForces, horner.XForces);
+            requireClose(settings.ElevationYTable, v, scalar.YForces, horner.YForces);
+            requireClose(settings.ElevationZTable, v, scalar.ZForces, horner.ZForces);
+        }
+    }
+
+    ForceConverter::setKernel(kernel);
+}
+
+// Run with ./test_ForceConverter "[benchmark]"
+TEST_CASE("Force converter kernels", "[.][benchmark]") {
+    ForceActuatorSettings settings;
+    fillTables(settings);
+    settings.transposeTables();
+
+    ForceConverter::Kernel kernel = ForceConverter::getKernel();
+
+    for (auto k : {ForceConverter::SCALAR, ForceConverter::TRANSPOSED, ForceConverter::HORNER}) {
+        const char* names[] = {"Scalar", "Transposed", "Horner"};
+        ForceConverter::setKernel(k);
+        BENCHMARK(std::string(names[k]) + " elevation") {
+            return ForceConverter::calculateForceFromElevationAngle(&settings, 45.2).ZForces[0];
+        };
+        BENCHMARK(std::string(names[k]) + " velocity") {
+            return ForceConverter::calculateForceFromAngularVelocity(&settings, 0.1, 0.2, 0.3).ZForces[0];
+        };
+    }
+
+    ForceConverter::setKernel(kernel);
+}
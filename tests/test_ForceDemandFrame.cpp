@@ -0,0 +1,132 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+
+#include <ForceDemandFrame.h>
+#include <ILCApplicationSettings.h>
+#include <ILCMessageFactory.h>
+
+using namespace LSST::M1M3::SS;
+
+static void writeFrame(ILCMessageFactory& factory, ModbusBuffer& buffer, uint8_t broadcastCounter,
+                       bool slewFlag, int32_t* primary, int32_t* secondary) {
+    int32_t saaPrimary[16];
+    int32_t daaPrimary[32];
+    int32_t daaSecondary[32];
+    memset(saaPrimary, 0, sizeof(saaPrimary));
+    memset(daaPrimary, 0, sizeof(daaPrimary));
+    memset(daaSecondary, 0, sizeof(daaSecondary));
+
+    // FA on addresses 1, 5, 16, 17, 30 and 48
+    saaPrimary[0] = primary[0];
+    saaPrimary[4] = primary[1];
+    saaPrimary[15] = primary[2];
+    daaPrimary[0] = primary[3];
+    daaSecondary[0] = secondary[0];
+    daaPrimary[13] = primary[4];
+    daaSecondary[13] = secondary[1];
+    daaPrimary[31] = primary[5];
+    daaSecondary[31] = secondary[2];
+
+    buffer.writeSubnet(3);
+    factory.broadcastForceDemand(&buffer, broadcastCounter, slewFlag, saaPrimary, daaPrimary, daaSecondary);
+    buffer.writeTimestamp();
+}
+
+TEST_CASE("Update force demand", "[ForceDemandFrame]") {
+    ILCApplicationSettings settings;
+    memset(&settings, 0, sizeof(settings));
+    settings.BroadcastForceDemand = 1200;
+    ILCMessageFactory factory(&settings);
+
+    int32_t primary[6] = {1000, -2000, 300000, 0, 12345, -1};
+    int32_t secondary[3] = {-500, 700, 8388607};
+
+    ModbusBuffer buffer;
+    writeFrame(factory, buffer, 0, false, primary, secondary);
+    int32_t length = buffer.getIndex();
+
+    ForceDemandFrame frame;
+    frame.reset(1);
+    frame.addActuator(1, 0, -1);
+    frame.addActuator(5, 1, -1);
+    frame.addActuator(16, 2, -1);
+    frame.addActuator(17, 3, 0);
+    frame.addActuator(30, 4, 1);
+    frame.addActuator(48, 5, 2);
+
+    for (int i = 0; i < 20; i++) {
+        uint8_t broadcastCounter = (i % 15) << 4;
+        bool slewFlag = i % 3 == 0;
+        primary[i % 6] += i * 1234 - 10000;
+        secondary[i % 3] -= i * 321;
+
+        frame.update(&buffer, broadcastCounter, slewFlag, primary, secondary);
+
+        ModbusBuffer expected;
+        writeFrame(factory, expected, broadcastCounter, slewFlag, primary, secondary);
+
+        REQUIRE(expected.getIndex() == length);
+        for (int j = 0; j < length; j++) {
+            REQUIRE(buffer.getBuffer()[j] == expected.getBuffer()[j]);
+        }
+    }
+}
+
+TEST_CASE("Fill zero setpoints template", "[ForceDemandFrame]") {
+    ILCApplicationSettings settings;
+    memset(&settings, 0, sizeof(settings));
+    settings.BroadcastForceDemand = 1200;
+    ILCMessageFactory factory(&settings);
+
+    int32_t primary[6] = {1000, -2000, 300000, 0, 12345, -1};
+    int32_t secondary[3] = {-500, 700, 8388607};
+
+    ModbusBuffer buffer;
+    buffer.writeSubnet(3);
+    factory.broadcastForceDemand(&buffer, 0x30, true);
+    buffer.writeTimestamp();
+
+    // actuators added out of address order
+    ForceDemandFrame frame;
+    frame.reset(1);
+    frame.addActuator(30, 4, 1);
+    frame.addActuator(1, 0, -1);
+    frame.addActuator(48, 5, 2);
+    frame.addActuator(5, 1, -1);
+    frame.addActuator(17, 3, 0);
+    frame.addActuator(16, 2, -1);
+
+    frame.update(&buffer, 0x30, true, primary, secondary);
+
+    ModbusBuffer expected;
+    writeFrame(factory, expected, 0x30, true, primary, secondary);
+
+    REQUIRE(buffer.getIndex() == expected.getIndex());
+    for (int j = 0; j < expected.getIndex(); j++) {
+        REQUIRE(buffer.getBuffer()[j] == expected.getBuffer()[j]);
+    }
+}
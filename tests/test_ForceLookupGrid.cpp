@@ -0,0 +1,183 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests force lookup grids.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+#include <ForceActuatorSettings.h>
+#include <ForceConverter.h>
+#include <ForceLookupGrid.h>
+
+using namespace LSST::M1M3::SS;
+using Catch::Approx;
+
+/**
+ * Fills elevation and azimuth tables with random coefficients decreasing
+ * with order.
+ */
+static void fillTables(ForceActuatorSettings& settings) {
+    std::mt19937 gen(4321);
+    std::uniform_real_distribution<float> dist(-1, 1);
+
+    for (auto table : {&settings.AzimuthXTable, &settings.AzimuthYTable, &settings.AzimuthZTable,
+                       &settings.ElevationXTable, &settings.ElevationYTable, &settings.ElevationZTable}) {
+        const float scale[] = {1e-9, 1e-7, 1e-4, 1e-2, 30, 100};
+        table->resize(FA_COUNT * 6);
+        for (size_t i = 0; i < table->size(); i++) {
+            (*table)[i] = dist(gen) * scale[i % 6];
+        }
+    }
+    settings.transposeTables();
+}
+
+static void enableLookup(ForceLookupSettings& lookup, float min, float max, float step, float maxError) {
+    lookup.Enabled = true;
+    lookup.Min = min;
+    lookup.Max = max;
+    lookup.Step = step;
+    lookup.MaxError = maxError;
+}
+
+TEST_CASE("Lookup grid interpolation", "[ForceLookupGrid]") {
+    ForceLookupGrid grid;
+    REQUIRE(grid.empty());
+    REQUIRE_FALSE(grid.contains(0));
+
+    // row i holds i * v + i and v^2
+    auto evaluate = [](float v, DistributedForces& forces) {
+        for (int i = 0; i < FA_COUNT; i++) {
+            forces.XForces[i] = i * v + i;
+            forces.YForces[i] = -v;
+            forces.ZForces[i] = v * v;
+        }
+    };
+
+    grid.build(0, 10, 0.5, evaluate);
+    REQUIRE(grid.size() == 21);
+    REQUIRE(grid.memorySize() == 21 * 3 * FA_COUNT * sizeof(float));
+    REQUIRE(grid.contains(0));
+    REQUIRE(grid.contains(10));
+    REQUIRE_FALSE(grid.contains(-0.1));
+    REQUIRE_FALSE(grid.contains(10.1));
+
+    DistributedForces forces;
+    for (float v : {0.0f, 0.25f, 3.3f, 9.75f, 10.0f}) {
+        grid.interpolate(v, forces);
+        for (int i = 0; i < FA_COUNT; i++) {
+            REQUIRE(forces.XForces[i] == Approx(i * v + i));
+            REQUIRE(forces.YForces[i] == Approx(-v));
+        }
+    }
+
+    // linear interpolation of v^2 is off by step^2 / 4 at cell midpoints
+    grid.interpolate(0.25, forces);
+    REQUIRE(forces.ZForces[0] == Approx(0.125));
+    REQUIRE(grid.verify(evaluate) == Approx(0.0625));
+
+    SECTION("Grid end is rounded up to whole step") {
+        grid.build(1, 2.2, 0.5, evaluate);
+        REQUIRE(grid.size() == 4);
+        REQUIRE(grid.contains(2.5));
+    }
+
+    SECTION("Invalid range") {
+        REQUIRE_THROWS_AS(grid.build(1, 1, 0.1, evaluate), std::invalid_argument);
+        REQUIRE_THROWS_AS(grid.build(0, 1, 0, evaluate), std::invalid_argument);
+        REQUIRE(grid.size() == 21);
+    }
+
+    grid.clear();
+    REQUIRE(grid.empty());
+}
+
+TEST_CASE("Lookup grids in force converter", "[ForceLookupGrid]") {
+    ForceActuatorSettings settings;
+    fillTables(settings);
+    settings.ElevationLookupSettings.Enabled = false;
+    settings.AzimuthLookupSettings.Enabled = false;
+    settings.buildLookups();
+    REQUIRE(settings.ElevationLookup.empty());
+    REQUIRE(settings.AzimuthLookup.empty());
+
+    auto polynomialElevation = ForceConverter::calculateForceFromElevationAngle(&settings, 45.123);
+    auto polynomialAzimuth = ForceConverter::calculateForceFromAzimuthAngle(&settings, -123.45);
+    auto polynomialOutside = ForceConverter::calculateForceFromElevationAngle(&settings, 95);
+
+    SECTION("Interpolated forces within error bound") {
+        enableLookup(settings.ElevationLookupSettings, 0, 90, 0.01, 0.01);
+        enableLookup(settings.AzimuthLookupSettings, -270, 270, 0.1, 0.05);
+        settings.buildLookups();
+        REQUIRE(settings.ElevationLookup.size() == 9001);
+        REQUIRE(settings.AzimuthLookup.size() == 5401);
+
+        auto elevation = ForceConverter::calculateForceFromElevationAngle(&settings, 45.123);
+        auto azimuth = ForceConverter::calculateForceFromAzimuthAngle(&settings, -123.45);
+        for (int i = 0; i < FA_COUNT; i++) {
+            REQUIRE(elevation.XForces[i] == Approx(polynomialElevation.XForces[i]).margin(0.01));
+            REQUIRE(elevation.ZForces[i] == Approx(polynomialElevation.ZForces[i]).margin(0.01));
+            REQUIRE(azimuth.YForces[i] == Approx(polynomialAzimuth.YForces[i]).margin(0.05));
+        }
+
+        // outside of grid range polynomial is evaluated
+        auto outside = ForceConverter::calculateForceFromElevationAngle(&settings, 95);
+        for (int i = 0; i < FA_COUNT; i++) {
+            REQUIRE(outside.ZForces[i] == polynomialOutside.ZForces[i]);
+        }
+    }
+
+    SECTION("Grid exceeding error bound isn't used") {
+        enableLookup(settings.ElevationLookupSettings, 0, 90, 5, 0.01);
+        settings.buildLookups();
+        REQUIRE(settings.ElevationLookup.empty());
+
+        auto elevation = ForceConverter::calculateForceFromElevationAngle(&settings, 45.123);
+        for (int i = 0; i < FA_COUNT; i++) {
+            REQUIRE(elevation.ZForces[i] == polynomialElevation.ZForces[i]);
+        }
+    }
+}
+
+// Run with ./test_ForceLookupGrid "[benchmark]"
+TEST_CASE("Lookup grid versus polynomial", "[.][benchmark]") {
+    ForceActuatorSettings settings;
+    fillTables(settings);
+    settings.ElevationLookupSettings.Enabled = false;
+    settings.AzimuthLookupSettings.Enabled = false;
+    settings.buildLookups();
+
+    BENCHMARK("Polynomial elevation") {
+        return ForceConverter::calculateForceFromElevationAngle(&settings, 45.2).ZForces[0];
+    };
+
+    enableLookup(settings.ElevationLookupSettings, 0, 90, 0.01, 0.01);
+    settings.buildLookups();
+
+    BENCHMARK("Interpolated elevation") {
+        return ForceConverter::calculateForceFromElevationAngle(&settings, 45.2).ZForces[0];
+    };
+}
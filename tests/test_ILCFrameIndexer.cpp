@@ -0,0 +1,117 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+#include <CRC.h>
+#include <ILCFrameIndexer.h>
+#include <Timestamp.h>
+
+using namespace LSST::M1M3::SS;
+
+/**
+ * Appends response frame, as written by FPGA, to buffer.
+ */
+static void addFrame(std::vector<uint16_t>& buffer, std::vector<uint8_t> data, uint64_t rawTimestamp,
+                     bool corruptCRC = false) {
+    uint16_t crc = CRC::modbus(data.data(), 0, data.size());
+    if (corruptCRC) {
+        crc ^= 0x0100;
+    }
+    data.push_back(crc & 0xFF);
+    data.push_back(crc >> 8);
+    for (auto d : data) {
+        buffer.push_back(0x9000 | (d << 1));
+    }
+    for (int i = 0; i < 8; i++) {
+        buffer.push_back(0xB000 | (rawTimestamp & 0xFF));
+        rawTimestamp >>= 8;
+    }
+    buffer.push_back(0xA000);
+}
+
+TEST_CASE("Index frames", "[ILCFrameIndexer]") {
+    // global timestamp
+    std::vector<uint16_t> buffer = {0x9001, 0xA000, 0xB000, 0x0000};
+
+    addFrame(buffer, {17, 75, 0x10, 0x42, 0x48, 0x00, 0x00}, 1234567890123);
+    addFrame(buffer, {18, 18, 0x01}, 1234567890456, true);
+    addFrame(buffer, {19, 76}, 1234567890789);
+
+    ILCFrameIndexer indexer;
+    REQUIRE(indexer.index(buffer.data(), 4, buffer.size()) == 3);
+
+    auto& frames = indexer.getFrames();
+
+    REQUIRE(frames[0].address == 17);
+    REQUIRE(frames[0].function == 75);
+    REQUIRE(frames[0].payloadOffset == 6);
+    REQUIRE(frames[0].payloadLength == 5);
+    REQUIRE(frames[0].crcOk);
+    REQUIRE(frames[0].timestamp == Timestamp::fromRaw(1234567890123));
+    REQUIRE(((buffer[frames[0].payloadOffset] >> 1) & 0xFF) == 0x10);
+
+    REQUIRE(frames[1].address == 18);
+    REQUIRE(frames[1].function == 18);
+    REQUIRE(frames[1].crcOk == false);
+    REQUIRE(frames[1].receivedCRC == (frames[1].calculatedCRC ^ 0x0100));
+    REQUIRE(frames[1].timestamp == Timestamp::fromRaw(1234567890456));
+
+    REQUIRE(frames[2].address == 19);
+    REQUIRE(frames[2].function == 76);
+    REQUIRE(frames[2].payloadLength == 0);
+    REQUIRE(frames[2].crcOk);
+}
+
+TEST_CASE("Malformed frames", "[ILCFrameIndexer]") {
+    std::vector<uint16_t> buffer;
+
+    // too short
+    buffer.push_back(0x9000 | (17 << 1));
+    buffer.push_back(0xA000);
+
+    addFrame(buffer, {17, 75, 0x10}, 100);
+
+    // missing end of frame
+    addFrame(buffer, {18, 75, 0x10}, 100);
+    buffer.pop_back();
+
+    ILCFrameIndexer indexer;
+    REQUIRE(indexer.index(buffer.data(), 0, buffer.size()) == 3);
+
+    auto& frames = indexer.getFrames();
+    REQUIRE(frames[0].address == 17);
+    REQUIRE(frames[0].function == 0);
+    REQUIRE(frames[0].crcOk == false);
+
+    REQUIRE(frames[1].crcOk);
+    REQUIRE(frames[1].payloadLength == 1);
+
+    REQUIRE(frames[2].address == 18);
+    REQUIRE(frames[2].crcOk == false);
+
+    // empty buffer
+    REQUIRE(indexer.index(buffer.data(), 0, 0) == 0);
+}
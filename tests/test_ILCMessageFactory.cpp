@@ -0,0 +1,115 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+
+#include <ILCApplicationSettings.h>
+#include <ILCFrameTable.h>
+#include <ILCMessageFactory.h>
+
+using namespace LSST::M1M3::SS;
+
+static void encode(ModbusBuffer& buffer, uint8_t address, uint8_t function, uint32_t timeout) {
+    buffer.writeU8(address);
+    buffer.writeU8(function);
+    buffer.writeCRC(2);
+    buffer.writeEndOfFrame();
+    buffer.writeWaitForRx(timeout);
+}
+
+static void requireSame(ModbusBuffer& a, ModbusBuffer& b) {
+    REQUIRE(a.getIndex() == b.getIndex());
+    for (int i = 0; i < a.getIndex(); i++) {
+        REQUIRE(a.getBuffer()[i] == b.getBuffer()[i]);
+    }
+}
+
+TEST_CASE("Frame table", "[ILCFrameTable]") {
+    ILCFrameTable table;
+    table.build(18, 270);
+
+    for (int address = 0; address < 256; address++) {
+        ModbusBuffer expected;
+        encode(expected, address, 18, 270);
+
+        ModbusBuffer buffer;
+        table.write(&buffer, address);
+        requireSame(buffer, expected);
+    }
+
+    // long timeout is encoded in ms
+    table.build(107, 84840);
+    ModbusBuffer expected;
+    encode(expected, 17, 107, 84840);
+    for (int i = 0; i < ILCFrameTable::FRAME_LENGTH; i++) {
+        REQUIRE(table.getFrame(17)[i] == expected.getBuffer()[i]);
+    }
+}
+
+TEST_CASE("Pre-encoded factory requests", "[ILCMessageFactory]") {
+    ILCApplicationSettings settings;
+    memset(&settings, 0, sizeof(settings));
+    settings.ReportServerID = 835;
+    settings.ReportServerStatus = 270;
+    settings.ElectromechanicalForceAndStatus = 300;
+    settings.ReadBoostValveDCAGains = 1100;
+    settings.PneumaticForceAndStatus = 320;
+    settings.Reset = 84840;
+    settings.ReadCalibration = 1725;
+    settings.ReportDCAPressure = 400;
+    settings.ReportDCAID = 385;
+    settings.ReportDCAStatus = 255;
+    settings.ReportLVDT = 400;
+
+    ILCMessageFactory factory(&settings);
+
+    ModbusBuffer buffer;
+    ModbusBuffer expected;
+    for (uint8_t address : {1, 17, 48, 84, 255}) {
+        factory.reportServerID(&buffer, address);
+        encode(expected, address, 17, 835);
+        factory.reportServerStatus(&buffer, address);
+        encode(expected, address, 18, 270);
+        factory.electromechanicalForceAndStatus(&buffer, address);
+        encode(expected, address, 67, 300);
+        factory.readBoostValveDCAGains(&buffer, address);
+        encode(expected, address, 74, 1100);
+        factory.pneumaticForceStatus(&buffer, address);
+        encode(expected, address, 76, 320);
+        factory.reset(&buffer, address);
+        encode(expected, address, 107, 84840);
+        factory.readCalibration(&buffer, address);
+        encode(expected, address, 110, 1725);
+        factory.reportDCAPressure(&buffer, address);
+        encode(expected, address, 119, 400);
+        factory.reportDCAID(&buffer, address);
+        encode(expected, address, 120, 385);
+        factory.reportDCAStatus(&buffer, address);
+        encode(expected, address, 121, 255);
+        factory.reportLVDT(&buffer, address);
+        encode(expected, address, 122, 400);
+    }
+    requireSame(buffer, expected);
+}
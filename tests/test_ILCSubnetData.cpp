@@ -0,0 +1,91 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <ForceActuatorApplicationSettings.h>
+#include <HardpointActuatorApplicationSettings.h>
+#include <HardpointMonitorApplicationSettings.h>
+#include <ILCSubnetData.h>
+
+using namespace LSST::M1M3::SS;
+
+TEST_CASE("Force actuator arrays and disabled FA", "[ILCSubnetData]") {
+    ForceActuatorApplicationSettings faSettings;
+    HardpointActuatorApplicationSettings hpSettings;
+    HardpointMonitorApplicationSettings hmSettings;
+    for (int i = 0; i < HP_COUNT; i++) {
+        hpSettings.Table.push_back(HardpointActuatorTableRow{i, i + 1, 0, 0, 0, 5, uint8_t(i + 1), 0, 0});
+        hmSettings.Table.push_back(HardpointMonitorTableRow{i, i + 1, 5, uint8_t(i + 84)});
+    }
+
+    ILCSubnetData subnetData(&faSettings, nullptr, &hpSettings, &hmSettings);
+
+    int32_t count = subnetData.getFACount(0);
+    REQUIRE(count > 2);
+    REQUIRE(subnetData.getFAAddresses(0).size() == count);
+    for (int i = 0; i < count; i++) {
+        const ILCMap& map = subnetData.getFAIndex(0, i);
+        REQUIRE(subnetData.getFAAddresses(0)[i] == map.Address);
+        REQUIRE(subnetData.getFADataIndices(0)[i] == map.DataIndex);
+        REQUIRE(subnetData.getFASecondaryDataIndices(0)[i] == map.SecondaryDataIndex);
+    }
+    REQUIRE(subnetData.getFACount(4) == 0);
+    REQUIRE(subnetData.findEnabledFA(4, 0) == -1);
+
+    int32_t first = subnetData.getFAIndex(0, 0).ActuatorId;
+    int32_t second = subnetData.getFAIndex(0, 1).ActuatorId;
+    int32_t last = subnetData.getFAIndex(0, count - 1).ActuatorId;
+
+    REQUIRE(subnetData.findEnabledFA(0, 0) == 0);
+    REQUIRE(subnetData.isDisabled(first) == false);
+
+    subnetData.disableFA(first);
+    subnetData.disableFA(second);
+    REQUIRE(subnetData.isDisabled(first));
+    REQUIRE(subnetData.isDisabled(second));
+    REQUIRE(subnetData.getMap(first).Disabled);
+    REQUIRE(subnetData.getFADisabledMask(0) == 3);
+    REQUIRE(subnetData.getFADisabled().count() == 2);
+    REQUIRE(subnetData.findEnabledFA(0, 0) == 2);
+    REQUIRE(subnetData.findEnabledFA(0, 1) == 2);
+    REQUIRE(subnetData.findEnabledFA(0, count - 1) == count - 1);
+
+    // wrap around
+    subnetData.disableFA(last);
+    REQUIRE(subnetData.findEnabledFA(0, count - 1) == 2);
+
+    subnetData.enableFA(first);
+    REQUIRE(subnetData.isDisabled(first) == false);
+    REQUIRE(subnetData.findEnabledFA(0, count - 1) == 0);
+
+    // hardpoints and unknown IDs are never disabled
+    REQUIRE(subnetData.isDisabled(1) == false);
+    REQUIRE(subnetData.isDisabled(100) == false);
+    REQUIRE(subnetData.isDisabled(10000) == false);
+
+    subnetData.enableAllFA();
+    REQUIRE(subnetData.getFADisabledMask(0) == 0);
+    REQUIRE(subnetData.getFADisabled().none());
+    REQUIRE(subnetData.isDisabled(second) == false);
+}
@@ -0,0 +1,93 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests LockFreeQueue class.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <LockFreeQueue.h>
+
+using namespace LSST::M1M3::SS;
+
+TEST_CASE("Push and pop", "[LockFreeQueue]") {
+    LockFreeQueue<int, 4> queue;
+    int v;
+
+    REQUIRE(queue.pop(v) == false);
+
+    for (int i = 1; i <= 4; i++) {
+        REQUIRE(queue.push(i) == true);
+    }
+    REQUIRE(queue.push(5) == false);
+
+    REQUIRE(queue.pop(v) == true);
+    REQUIRE(v == 1);
+    REQUIRE(queue.push(5) == true);
+
+    for (int i = 2; i <= 5; i++) {
+        REQUIRE(queue.pop(v) == true);
+        REQUIRE(v == i);
+    }
+    REQUIRE(queue.pop(v) == false);
+}
+
+TEST_CASE("Multiple producers", "[LockFreeQueue]") {
+    const int PRODUCERS = 4;
+    const int ITEMS = 10000;
+
+    LockFreeQueue<int, 64> queue;
+    std::vector<std::thread> producers;
+
+    for (int p = 0; p < PRODUCERS; p++) {
+        producers.emplace_back([&queue, p] {
+            for (int i = 0; i < ITEMS; i++) {
+                while (queue.push(p * ITEMS + i) == false) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> last(PRODUCERS, -1);
+    int received = 0;
+    while (received < PRODUCERS * ITEMS) {
+        int v;
+        if (queue.pop(v) == false) {
+            std::this_thread::yield();
+            continue;
+        }
+        // items from a single producer shall be received in order
+        int p = v / ITEMS;
+        REQUIRE(v % ITEMS == last[p] + 1);
+        last[p] = v % ITEMS;
+        received++;
+    }
+
+    for (auto& t : producers) {
+        t.join();
+    }
+
+    int v;
+    REQUIRE(queue.pop(v) == false);
+}
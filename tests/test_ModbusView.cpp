@@ -0,0 +1,102 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+
+#include <ModbusBuffer.h>
+#include <ModbusView.h>
+
+using namespace LSST::M1M3::SS;
+
+TEST_CASE("Read values", "[ModbusView]") {
+    ModbusBuffer mbuf;
+    mbuf.writeU8(0x81);
+    mbuf.writeU16(0x1234);
+    mbuf.writeU32(0xDEADBEEF);
+    mbuf.writeI32(-12345);
+    mbuf.writeSGL(3.125);
+    mbuf.writeU8(0xAB);
+
+    ModbusView frame(mbuf.getBuffer(), mbuf.getIndex());
+    REQUIRE(frame.size() == 16);
+
+    mbuf.reset();
+
+    REQUIRE(frame.readU8() == 0x81);
+    REQUIRE(frame.readU16() == 0x1234);
+    REQUIRE(frame.readU32() == 0xDEADBEEF);
+    REQUIRE(frame.readI32() == -12345);
+    REQUIRE(frame.readSGL() == 3.125);
+    REQUIRE(frame.position() == 15);
+    REQUIRE(frame.remaining() == 1);
+    REQUIRE(frame.readU8() == 0xAB);
+    REQUIRE(frame.remaining() == 0);
+
+    // ModbusBuffer decodes the same values
+    REQUIRE(mbuf.readU8() == 0x81);
+    REQUIRE(mbuf.readU16() == 0x1234);
+    REQUIRE(mbuf.readU32() == 0xDEADBEEF);
+    REQUIRE(mbuf.readI32() == -12345);
+    REQUIRE(mbuf.readSGL() == 3.125);
+
+    REQUIRE(frame.at(0) == 0x81);
+    REQUIRE(frame.at(15) == 0xAB);
+}
+
+TEST_CASE("Read U48 and bytes", "[ModbusView]") {
+    ModbusBuffer mbuf;
+    uint8_t data[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 'M', '1', 'M', '3'};
+    for (auto d : data) mbuf.writeU8(d);
+
+    ModbusView frame(mbuf.getBuffer(), mbuf.getIndex());
+    REQUIRE(frame.readU48() == 0x010203040506);
+
+    uint8_t name[4];
+    frame.readBytes(name, 4);
+    REQUIRE(name[0] == 'M');
+    REQUIRE(name[3] == '3');
+}
+
+TEST_CASE("Bounds checks", "[ModbusView]") {
+    ModbusBuffer mbuf;
+    mbuf.writeU16(0x1234);
+    mbuf.writeU8(0x56);
+
+    ModbusView frame(mbuf.getBuffer(), 3);
+
+    REQUIRE_THROWS_AS(frame.readU32(), std::out_of_range);
+    // failed read doesn't move cursor
+    REQUIRE(frame.position() == 0);
+    REQUIRE(frame.readU16() == 0x1234);
+    REQUIRE_THROWS_AS(frame.readU16(), std::out_of_range);
+    REQUIRE_THROWS_AS(frame.skip(2), std::out_of_range);
+    REQUIRE_THROWS_AS(frame.at(3), std::out_of_range);
+    REQUIRE(frame.readU8() == 0x56);
+    REQUIRE_THROWS_AS(frame.readU8(), std::out_of_range);
+
+    ModbusView empty(mbuf.getBuffer(), 0);
+    REQUIRE_THROWS_AS(empty.readU8(), std::out_of_range);
+    REQUIRE_THROWS_AS(empty.skip(static_cast<size_t>(-1)), std::out_of_range);
+}
@@ -0,0 +1,122 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <stdexcept>
+
+#include <FPGAAddresses.h>
+#include <ModbusBuffer.h>
+#include <ModbusWireTime.h>
+
+using namespace LSST::M1M3::SS;
+using Catch::Approx;
+
+/**
+ * Writes subnet transaction the way BusList does.
+ */
+static void writeSubnet(ModbusBuffer& buffer, uint8_t txAddress, int frames, int bytes, uint32_t rxWait) {
+    buffer.writeSubnet(txAddress);
+    int32_t lengthIndex = buffer.getIndex();
+    buffer.writeLength(0);
+    buffer.writeSoftwareTrigger();
+    for (int f = 0; f < frames; f++) {
+        for (int b = 0; b < bytes; b++) {
+            buffer.writeU8(b);
+        }
+        buffer.writeEndOfFrame();
+        buffer.writeWaitForRx(rxWait);
+    }
+    buffer.writeTimestamp();
+    buffer.writeTriggerIRQ();
+    buffer.set(lengthIndex, buffer.getIndex() - lengthIndex - 1);
+}
+
+TEST_CASE("Character time", "[ModbusWireTime]") {
+    ModbusWireTime wireTime(2000000);
+    REQUIRE(wireTime.getCharacterTime() == Approx(5));
+    REQUIRE(wireTime.getFrameEndTime() == Approx(17.5));
+
+    ModbusWireTime slow(115200, 11);
+    REQUIRE(slow.getCharacterTime() == Approx(95.486).epsilon(1e-4));
+}
+
+TEST_CASE("Subnets", "[ModbusWireTime]") {
+    ModbusWireTime wireTime(2000000);
+    ModbusBuffer buffer;
+
+    writeSubnet(buffer, FPGAAddresses::ModbusSubnetATx, 2, 8, 300);
+    writeSubnet(buffer, FPGAAddresses::ModbusSubnetETx, 3, 4, 5000);
+    writeSubnet(buffer, 99, 1, 1, 0);
+
+    auto subnets = wireTime.analyze(buffer.getBuffer(), buffer.getIndex());
+    REQUIRE(subnets.size() == 3);
+
+    REQUIRE(subnets[0].subnet == 0);
+    REQUIRE(subnets[0].txAddress == FPGAAddresses::ModbusSubnetATx);
+    REQUIRE(subnets[0].frames == 2);
+    REQUIRE(subnets[0].txBytes == 16);
+    REQUIRE(subnets[0].txTime == Approx(16 * 5 + 2 * 17.5));
+    REQUIRE(subnets[0].waitTime == Approx(600));
+
+    // timeouts above 4095 us are written in ms, rounded up
+    REQUIRE(subnets[1].subnet == 4);
+    REQUIRE(subnets[1].frames == 3);
+    REQUIRE(subnets[1].txBytes == 12);
+    REQUIRE(subnets[1].waitTime == Approx(3 * 6000));
+    REQUIRE(subnets[1].total() == Approx(12 * 5 + 3 * 17.5 + 18000));
+
+    REQUIRE(subnets[2].subnet == -1);
+    REQUIRE(subnets[2].txAddress == 99);
+
+    REQUIRE(ModbusWireTime::busiest(subnets) == &subnets[1]);
+    REQUIRE(ModbusWireTime::busiest(std::vector<SubnetWireTime>()) == nullptr);
+}
+
+TEST_CASE("Delays", "[ModbusWireTime]") {
+    ModbusWireTime wireTime(1000000);
+    ModbusBuffer buffer;
+
+    buffer.writeSubnet(FPGAAddresses::ModbusSubnetBTx);
+    buffer.writeLength(3);
+    buffer.writeSoftwareTrigger();
+    buffer.writeDelay(250);
+    buffer.writeDelay(7000);
+
+    auto subnets = wireTime.analyze(buffer.getBuffer(), buffer.getIndex());
+    REQUIRE(subnets.size() == 1);
+    REQUIRE(subnets[0].subnet == 1);
+    REQUIRE(subnets[0].frames == 0);
+    REQUIRE(subnets[0].txTime == 0);
+    REQUIRE(subnets[0].waitTime == Approx(250 + 8000));
+}
+
+TEST_CASE("Truncated buffer", "[ModbusWireTime]") {
+    ModbusWireTime wireTime(2000000);
+    uint16_t buffer[] = {FPGAAddresses::ModbusSubnetATx, 10, 0x8000, 0x1202};
+
+    REQUIRE_THROWS_AS(wireTime.analyze(buffer, 4), std::runtime_error);
+    REQUIRE_THROWS_AS(wireTime.analyze(buffer, 1), std::runtime_error);
+    REQUIRE(wireTime.analyze(buffer, 0).empty());
+}
@@ -0,0 +1,113 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests neighbor tables.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <random>
+#include <vector>
+
+#include <DataTypes.h>
+#include <NeighborTable.h>
+
+using namespace LSST::M1M3::SS;
+
+TEST_CASE("Neighbor table rows", "[NeighborTable]") {
+    NeighborTable table;
+    REQUIRE(table.getRows() == 0);
+
+    table.addRow({1, 2});
+    table.addRow({});
+    table.addRow({0, 1, 2});
+
+    REQUIRE(table.getRows() == 3);
+    CHECK(table.getCount(0) == 2);
+    CHECK(table.getCount(1) == 0);
+    CHECK(table.getCount(2) == 3);
+    CHECK(table.getRow(0)[1] == 2);
+    CHECK(table.getRow(2)[0] == 0);
+
+    const float values[] = {1, 10, 100};
+
+    SECTION("Sums from zero") {
+        const float initial[] = {0, 0, 0};
+        float sums[3];
+        table.gatherSum(values, initial, sums);
+        CHECK(sums[0] == 110);
+        CHECK(sums[1] == 0);
+        CHECK(sums[2] == 111);
+    }
+
+    SECTION("In-place sums") {
+        double sums[] = {1, 10, 100};
+        table.gatherSum(values, sums, sums);
+        CHECK(sums[0] == 111);
+        CHECK(sums[1] == 10);
+        CHECK(sums[2] == 211);
+    }
+
+    table.clear();
+    CHECK(table.getRows() == 0);
+}
+
+// Run with ./test_NeighborTable "[benchmark]"
+TEST_CASE("Neighbor sums", "[.][benchmark]") {
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> indexDist(0, FA_COUNT - 1);
+    std::uniform_real_distribution<float> forceDist(-500, 500);
+
+    // far neighbor lists are about 12 actuators long
+    std::vector<std::vector<int>> vectors(FA_COUNT);
+    NeighborTable table;
+    for (auto& neighbors : vectors) {
+        for (int n = 0; n < 12; n++) {
+            neighbors.push_back(indexDist(gen));
+        }
+        table.addRow(neighbors);
+    }
+
+    float forces[FA_COUNT];
+    double initial[FA_COUNT];
+    for (int i = 0; i < FA_COUNT; i++) {
+        forces[i] = forceDist(gen);
+        initial[i] = forces[i];
+    }
+    double sums[FA_COUNT];
+
+    BENCHMARK("Per-actuator vectors") {
+        for (int i = 0; i < FA_COUNT; i++) {
+            double sum = initial[i];
+            int count = vectors[i].size();
+            for (int n = 0; n < count; n++) {
+                sum += forces[vectors[i][n]];
+            }
+            sums[i] = sum;
+        }
+        return sums[0];
+    };
+
+    BENCHMARK("CSR gather") {
+        table.gatherSum(forces, initial, sums);
+        return sums[0];
+    };
+}
@@ -0,0 +1,115 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests OuterLoopMonitor class.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <OuterLoopMonitor.h>
+
+#include <cstring>
+
+using namespace LSST::M1M3::SS;
+using namespace std::chrono_literals;
+using Catch::Approx;
+
+static StageProfiler::Statistics stageStatistics(OuterLoopMonitor& monitor, const char* stage) {
+    StageProfiler& profiler = monitor.getProfiler();
+    for (size_t i = 0; i < profiler.getStageCount(); i++) {
+        auto stat = profiler.getStatistics(i);
+        if (strcmp(stat.stage, stage) == 0) {
+            return stat;
+        }
+    }
+    FAIL("Stage " << stage << " not found");
+    return StageProfiler::Statistics{};
+}
+
+TEST_CASE("Interval and latency statistics", "[OuterLoopMonitor]") {
+    OuterLoopMonitor monitor(20ms, 1ms, 100);
+    auto now = std::chrono::steady_clock::now();
+
+    // update without tick isn't recorded
+    monitor.updateStarted(now);
+    REQUIRE(monitor.getProfiler().getStageCount() == 0);
+
+    // 19, 20 and 21 ms intervals, update starts 1 ms after tick
+    monitor.tick(now);
+    monitor.updateStarted(now + 1ms);
+    for (auto interval : {19ms, 20ms, 21ms}) {
+        now += interval;
+        monitor.tick(now);
+        monitor.updateStarted(now + 1ms);
+    }
+
+    REQUIRE(monitor.getTicks() == 4);
+    REQUIRE(monitor.getMissedTicks() == 0);
+    REQUIRE(monitor.getConsecutiveMisses() == 0);
+
+    auto interval = stageStatistics(monitor, "interval");
+    REQUIRE(interval.samples == 3);
+    REQUIRE(interval.min == Approx(19000));
+    REQUIRE(interval.mean == Approx(20000));
+    REQUIRE(interval.max == Approx(21000));
+
+    auto latency = stageStatistics(monitor, "tick to update");
+    REQUIRE(latency.samples == 4);
+    REQUIRE(latency.min == Approx(1000));
+    REQUIRE(latency.max == Approx(1000));
+}
+
+TEST_CASE("Deadline misses", "[OuterLoopMonitor]") {
+    OuterLoopMonitor monitor(20ms, 1ms, 100);
+    auto now = std::chrono::steady_clock::now();
+
+    monitor.tick(now);
+
+    // jitter within tolerance isn't a miss
+    now += 21ms;
+    monitor.tick(now);
+    REQUIRE(monitor.getMissedTicks() == 0);
+    REQUIRE(monitor.getConsecutiveMisses() == 0);
+
+    // update overran by 4 ms, clock IRQ stayed latched
+    now += 24ms;
+    monitor.tick(now);
+    REQUIRE(monitor.getMissedTicks() == 1);
+    REQUIRE(monitor.getConsecutiveMisses() == 1);
+
+    // 3 periods - 2 ticks skipped
+    now += 60ms;
+    monitor.tick(now);
+    REQUIRE(monitor.getMissedTicks() == 3);
+    REQUIRE(monitor.getConsecutiveMisses() == 2);
+
+    // on time tick clears consecutive misses, total is kept
+    now += 19ms;
+    monitor.tick(now);
+    REQUIRE(monitor.getMissedTicks() == 3);
+    REQUIRE(monitor.getConsecutiveMisses() == 0);
+
+    now += 40ms;
+    monitor.tick(now);
+    REQUIRE(monitor.getTicks() == 6);
+    REQUIRE(monitor.getMissedTicks() == 4);
+    REQUIRE(monitor.getConsecutiveMisses() == 1);
+}
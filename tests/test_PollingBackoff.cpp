@@ -0,0 +1,118 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests PollingBackoff class.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <PollingBackoff.h>
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+#include <sys/resource.h>
+
+using namespace LSST::M1M3::SS;
+using namespace std::chrono_literals;
+
+TEST_CASE("Interval back-off", "[PollingBackoff]") {
+    PollingBackoff backoff(100us, 1ms);
+
+    REQUIRE(backoff.getInterval() == 100us);
+
+    backoff.processed(false);
+    REQUIRE(backoff.getInterval() == 200us);
+    for (int i = 0; i < 10; i++) {
+        backoff.processed(false);
+    }
+    REQUIRE(backoff.getInterval() == 1ms);
+
+    backoff.processed(true);
+    REQUIRE(backoff.getInterval() == 100us);
+}
+
+/**
+ * Simulates SubscriberThread loop with 44 topics. Producer thread publishes
+ * data every 20ms on a single topic. Measures consumer CPU time and latency
+ * between data being published and the topic being processed.
+ */
+static void benchmarkBackoff(const char* name, PollingBackoff& backoff) {
+    const int TOPICS = 44;
+    const int SAMPLES = 100;
+
+    std::atomic<int64_t> published(0);
+    std::atomic<bool> keepRunning(true);
+
+    double latencySum = 0;
+    double latencyMax = 0;
+    int received = 0;
+
+    std::thread producer([&] {
+        for (int i = 0; i < SAMPLES; i++) {
+            std::this_thread::sleep_for(20ms);
+            published = std::chrono::steady_clock::now().time_since_epoch().count();
+        }
+        std::this_thread::sleep_for(20ms);
+        keepRunning = false;
+    });
+
+    struct rusage start, end;
+    getrusage(RUSAGE_THREAD, &start);
+    while (keepRunning) {
+        bool dataReceived = false;
+        for (int i = 0; i < TOPICS; i++) {
+            // "tryAccept" - only the first topic has data
+            if (i > 0 || published.load() == 0) {
+                continue;
+            }
+            int64_t p = published.exchange(0);
+            if (p != 0) {
+                double latency = (std::chrono::steady_clock::now().time_since_epoch().count() - p) / 1000.0;
+                latencySum += latency;
+                latencyMax = std::max(latencyMax, latency);
+                received++;
+                dataReceived = true;
+            }
+        }
+        backoff.processed(dataReceived);
+        backoff.sleep();
+    }
+    getrusage(RUSAGE_THREAD, &end);
+    producer.join();
+
+    auto usec = [](const timeval& tv) { return tv.tv_sec * 1e6 + tv.tv_usec; };
+    double cpu = usec(end.ru_utime) - usec(start.ru_utime) + usec(end.ru_stime) - usec(start.ru_stime);
+
+    std::cout << name << ": CPU " << cpu / 1000.0 << " ms / " << (SAMPLES + 1) * 20 << " ms, latency mean "
+              << latencySum / received << " us max " << latencyMax << " us (" << received << " samples)"
+              << std::endl;
+
+    REQUIRE(received == SAMPLES);
+}
+
+TEST_CASE("Subscriber loop CPU usage and latency", "[.][benchmark]") {
+    PollingBackoff fixedPolling(100us, 100us);
+    benchmarkBackoff("fixed 100us polling", fixedPolling);
+
+    PollingBackoff adaptivePolling(100us, 2ms);
+    benchmarkBackoff("adaptive polling", adaptivePolling);
+}
@@ -0,0 +1,118 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests StageProfiler class.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <StageProfiler.h>
+
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/ostream_sink.h>
+
+#include <sstream>
+
+using namespace LSST::M1M3::SS;
+using namespace std::chrono_literals;
+using Catch::Approx;
+
+TEST_CASE("Statistics", "[StageProfiler]") {
+    StageProfiler profiler("test", 100, 0);
+
+    for (int i = 1; i <= 100; i++) {
+        profiler.addSample("first", std::chrono::microseconds(i));
+        profiler.addSample("second", 20us);
+    }
+
+    REQUIRE(profiler.getStageCount() == 2);
+
+    auto first = profiler.getStatistics(0);
+    REQUIRE(first.samples == 100);
+    REQUIRE(first.min == 1);
+    REQUIRE(first.max == 100);
+    REQUIRE(first.mean == Approx(50.5));
+    REQUIRE(first.p99 == 99);
+
+    auto second = profiler.getStatistics(1);
+    REQUIRE(second.samples == 100);
+    REQUIRE(second.min == 20);
+    REQUIRE(second.mean == Approx(20));
+    REQUIRE(second.p99 == 20);
+    REQUIRE(second.max == 20);
+}
+
+TEST_CASE("Rolling window", "[StageProfiler]") {
+    StageProfiler profiler("test", 10, 0);
+
+    profiler.addSample("stage", 1ms);
+    REQUIRE(profiler.getStatistics(0).max == 1000);
+
+    for (int i = 0; i < 10; i++) {
+        profiler.addSample("stage", 5us);
+    }
+
+    auto stat = profiler.getStatistics(0);
+    REQUIRE(stat.samples == 10);
+    REQUIRE(stat.min == 5);
+    REQUIRE(stat.max == 5);
+}
+
+TEST_CASE("Loop stages", "[StageProfiler]") {
+    StageProfiler profiler("test", 10, 0);
+
+    for (int i = 0; i < 3; i++) {
+        profiler.start();
+        profiler.mark("a");
+        profiler.mark("b");
+        profiler.end();
+    }
+
+    REQUIRE(profiler.getStageCount() == 3);
+    REQUIRE(std::string(profiler.getStatistics(0).stage) == "a");
+    REQUIRE(std::string(profiler.getStatistics(1).stage) == "b");
+    REQUIRE(std::string(profiler.getStatistics(2).stage) == "total");
+    REQUIRE(profiler.getStatistics(2).samples == 3);
+}
+
+TEST_CASE("Report from reporting thread", "[StageProfiler]") {
+    std::ostringstream log;
+    auto logger = std::make_shared<spdlog::logger>("test",
+                                                   std::make_shared<spdlog::sinks::ostream_sink_mt>(log));
+    auto defaultLogger = spdlog::default_logger();
+    spdlog::set_default_logger(logger);
+
+    {
+        StageProfiler profiler("loop", 10, 2);
+        for (int i = 0; i < 2; i++) {
+            profiler.start();
+            profiler.mark("stage");
+            profiler.end();
+        }
+        // destructor waits for the pending report
+    }
+
+    spdlog::set_default_logger(defaultLogger);
+
+    REQUIRE(log.str().find("loop profile (us)") != std::string::npos);
+    REQUIRE(log.str().find("stage:") != std::string::npos);
+    REQUIRE(log.str().find("(2 samples)") != std::string::npos);
+}
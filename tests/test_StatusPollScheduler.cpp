@@ -0,0 +1,120 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+#include <StatusPollScheduler.h>
+
+using namespace LSST::M1M3::SS;
+
+TEST_CASE("Round robin with single request budget", "[StatusPollScheduler]") {
+    StatusPollScheduler scheduler;
+    for (int i = 0; i < 10; i++) {
+        REQUIRE(scheduler.addRequest(270, 1) == static_cast<size_t>(i));
+    }
+    REQUIRE(scheduler.size() == 10);
+    REQUIRE(scheduler.getMinimalCost() == 270);
+
+    std::vector<int> counts(10, 0);
+    for (int cycle = 0; cycle < 100; cycle++) {
+        auto& scheduled = scheduler.schedule(300, 10);
+        REQUIRE(scheduled.size() == 1);
+        counts[scheduled[0]]++;
+        // the oldest request is scheduled
+        REQUIRE(scheduled[0] == static_cast<size_t>(cycle % 10));
+    }
+    for (auto c : counts) {
+        REQUIRE(c == 10);
+    }
+}
+
+TEST_CASE("Budget", "[StatusPollScheduler]") {
+    StatusPollScheduler scheduler;
+    scheduler.addRequest(270, 1);
+    scheduler.addRequest(255, 1);
+    scheduler.addRequest(400, 1);
+
+    SECTION("All fit") { REQUIRE(scheduler.schedule(925, 3).size() == 3); }
+
+    SECTION("Slots limit") { REQUIRE(scheduler.schedule(925, 2).size() == 2); }
+
+    SECTION("Skip too expensive") {
+        auto& scheduled = scheduler.schedule(600, 3);
+        REQUIRE(scheduled == std::vector<size_t>{0, 1});
+        // next cycle the expensive request is the oldest, but doesn't fit with the others
+        REQUIRE(scheduler.schedule(600, 3) == std::vector<size_t>{2});
+    }
+
+    SECTION("Over budget") {
+        // at least one request is always scheduled
+        REQUIRE(scheduler.schedule(100, 3).size() == 1);
+        REQUIRE(scheduler.schedule(0, 3).size() == 1);
+    }
+
+    SECTION("No slots") { REQUIRE(scheduler.schedule(1000, 0).empty()); }
+}
+
+TEST_CASE("Period", "[StatusPollScheduler]") {
+    StatusPollScheduler scheduler;
+    // three requests every cycle, one every 5th, budget for 2 requests per cycle
+    for (int i = 0; i < 3; i++) {
+        scheduler.addRequest(100, 1);
+    }
+    scheduler.addRequest(100, 5);
+
+    std::vector<int> counts(4, 0);
+    for (int cycle = 0; cycle < 1000; cycle++) {
+        for (auto i : scheduler.schedule(200, 4)) {
+            counts[i]++;
+        }
+    }
+    REQUIRE(counts[0] + counts[1] + counts[2] + counts[3] == 2000);
+    REQUIRE(counts[3] > 0);
+    for (int i = 0; i < 3; i++) {
+        REQUIRE(counts[i] > 2 * counts[3]);
+    }
+}
+
+TEST_CASE("Boost", "[StatusPollScheduler]") {
+    StatusPollScheduler scheduler(4, 10);
+    for (int i = 0; i < 8; i++) {
+        scheduler.addRequest(270, 1);
+    }
+
+    std::vector<int> counts(8, 0);
+    for (int cycle = 0; cycle < 80; cycle++) {
+        scheduler.setBoosted(5, cycle < 40);
+        for (auto i : scheduler.schedule(270, 8)) {
+            counts[i]++;
+        }
+    }
+    // boosted request is polled more often, others aren't starved
+    for (int i = 0; i < 8; i++) {
+        REQUIRE(counts[i] > 0);
+        if (i != 5) {
+            REQUIRE(counts[5] > counts[i]);
+        }
+    }
+}